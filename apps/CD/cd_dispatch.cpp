@@ -0,0 +1,201 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <iostream>
+#include <stdlib.h>
+#include "darts.h"
+
+#define INNER 100
+#define OUTER 100
+
+using namespace darts;
+
+//The same codelet dispatched through the vtable and, sealed, through CodeletT
+
+class virtualCD : public Codelet
+{
+public:
+    Codelet * toSignal;
+    virtualCD(void) : Codelet() { }
+    virtual void fire(void)
+    {
+        toSignal->decDep();
+    }
+};
+
+class directCD final : public CodeletT<directCD>
+{
+public:
+    Codelet * toSignal;
+    directCD(void) : CodeletT<directCD>() { }
+    virtual void fire(void)
+    {
+        toSignal->decDep();
+    }
+};
+
+//Chain of depth codelets in one TP, each enabling the next one
+template<class CD>
+class chainTP : public ThreadedProcedure
+{
+public:
+    int depth;
+    CD * chain;
+
+    chainTP(int theDepth, Codelet * toSig) :
+    ThreadedProcedure(),
+    depth(theDepth),
+    chain(new CD[theDepth])
+    {
+        for (int i = 0; i < depth; i++)
+        {
+            chain[i].initCodelet((i) ? 1 : 0, (i) ? 1 : 0, this, SHORTWAIT);
+            chain[i].toSignal = (i < depth - 1) ? static_cast<Codelet*>(&chain[i + 1]) : toSig;
+        }
+        add(&chain[0]);
+    }
+    
+    ~chainTP(void)
+    {
+        delete [] chain;
+    }
+};
+
+//Counts the fires without a runtime, K makes distinct classes so a queue
+//can mix them and the compiler cannot guess the fire of a virtual call
+static uint64_t fired = 0;
+
+template<int K>
+class countCD : public Codelet
+{
+public:
+    countCD(void) : Codelet() { }
+    virtual void fire(void) { fired += K; }
+};
+
+template<int K>
+class countDirectCD final : public CodeletT< countDirectCD<K> >
+{
+public:
+    countDirectCD(void) : CodeletT< countDirectCD<K> >() { }
+    virtual void fire(void) { fired += K; }
+};
+
+template< template<int> class CD >
+Codelet *
+newCount(int kind)
+{
+    switch (kind)
+    {
+        case 0: return new CD<1>();
+        case 1: return new CD<2>();
+        case 2: return new CD<3>();
+        default: return new CD<4>();
+    }
+}
+
+//Dispatches every codelet of the queue like a scheduler loop does, the
+//queue holds kinds classes round robin. Returns ns per codelet
+template< template<int> class CD >
+double
+dispatchLoop(int n, int kinds, int reps)
+{
+    Codelet ** queue = new Codelet*[n];
+    uint64_t expect = 0;
+    for (int i = 0; i < n; i++)
+    {
+        queue[i] = newCount<CD>(i % kinds);
+        expect += (i % kinds < 3) ? i % kinds + 1 : 4;
+    }
+    fired = 0;
+    uint64_t startTime = getTime();
+    for (int r = 0; r < reps; r++)
+        for (int i = 0; i < n; i++)
+            queue[i]->dispatch();
+    uint64_t endTime = getTime();
+    if (fired != expect * reps)
+        std::cout << "wrong count " << fired << std::endl;
+    for (int i = 0; i < n; i++)
+        delete queue[i];
+    delete [] queue;
+    return (double) (endTime - startTime) / ((double) n * reps);
+}
+
+template<class CD>
+uint64_t
+chainTest(Runtime * rt, int depth)
+{
+    uint64_t innerTime = 0;
+    uint64_t outerTime = 0;
+    for (int i = 0; i < OUTER; i++) 
+    {
+        rt->run(launch<chainTP<CD> >(depth, &Runtime::finalSignal));
+        for (int j = 0; j < INNER; j++) 
+        {
+            uint64_t startTime = getTime();
+            rt->run(launch<chainTP<CD> >(depth, &Runtime::finalSignal));
+            uint64_t endTime = getTime();
+            innerTime += endTime - startTime;
+        }
+        outerTime += innerTime / INNER;
+        innerTime = 0;
+    }
+    return outerTime / OUTER;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 6)
+    {
+        std::cout << "enter number of TP CD TPM CDM depth" << std::endl;
+        return 0;
+    }
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    int tpm = atoi(argv[3]);
+    int cdm = atoi(argv[4]);
+    int depth = atoi(argv[5]);
+    if (depth < 1)
+        return 0;
+    
+    //Dispatch alone, ns per codelet, with one class and with four mixed
+    int reps = 100000000 / depth;
+    for (int kinds = 1; kinds <= 4; kinds += 3)
+        std::cout << "dispatch " << kinds << " classes virtual " << dispatchLoop<countCD>(depth, kinds, reps)
+                  << " direct " << dispatchLoop<countDirectCD>(depth, kinds, reps) << std::endl;
+    
+    //A chain of codelets through the runtime, ns per codelet
+    ThreadAffinity affin(cds, tps, SPREAD, tpm, cdm);
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        uint64_t virtualChain = chainTest<virtualCD>(rt, depth);
+        uint64_t directChain = chainTest<directCD>(rt, depth);
+        std::cout << "chain virtual " << (double) virtualChain / depth << " direct " << (double) directChain / depth << std::endl;
+        delete rt;
+    }
+    return 0;
+}
@@ -27,6 +27,7 @@
 
 
 #include <iostream>
+#include <string.h>
 #include "darts.h"
 
 #define INNER 1000
@@ -89,11 +90,23 @@ cdSerialEmpty::fire(void)
     sig->decDep();
 }
 
+//Builds the graph every run, or replays it once graph captured it
+static void
+runCdSerial(Runtime * rt, taskGraph * graph, int depth)
+{
+    if(!graph)
+        rt->run(launch<cdSerial>(depth, &Runtime::finalSignal));
+    else if(graph->captured())
+        rt->run(*graph, NULL);
+    else
+        rt->run(*graph, launch<cdSerial>(depth, &Runtime::finalSignal));
+}
+
 int main(int argc, char *argv[])
 {
-    if (argc != 6)
+    if (argc != 6 && argc != 7)
     {
-        std::cout << "enter number of TP CD TPM CDM depth" << std::endl;
+        std::cout << "enter number of TP CD TPM CDM depth [graph]" << std::endl;
         return 0;
     }
     int tps = atoi(argv[1]);
@@ -110,14 +123,15 @@ int main(int argc, char *argv[])
         if (affin.generateMask())
         {
             Runtime * rt = new Runtime(&affin);
+            taskGraph * graph = (argc == 7 && !strcmp(argv[6], "graph")) ? new taskGraph : NULL;
 
             for (int i = 0; i < OUTER; i++) 
             {
-                rt->run(launch<cdSerial> (depth, &Runtime::finalSignal));
+                runCdSerial(rt, graph, depth);
                 for (int j = 0; j < INNER; j++) 
                 {
                     uint64_t startTime = getTime();
-                    rt->run(launch<cdSerial> (depth, &Runtime::finalSignal));
+                    runCdSerial(rt, graph, depth);
                     uint64_t endTime = getTime();
                     innerTime += endTime - startTime;
                 }
@@ -125,6 +139,7 @@ int main(int argc, char *argv[])
                 innerTime = 0;
             }
             std::cout << outerTime/OUTER << std::endl;
+            delete graph;
             delete rt;
         }
     }
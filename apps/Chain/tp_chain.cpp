@@ -28,6 +28,7 @@
 
 #include <iostream>
 #include <stdlib.h>
+#include <string.h>
 #include <stdint.h>
 #include "getClock.h"
 #include "darts.h"
@@ -78,11 +79,23 @@ empty::fire(void)
     }
 }
 
+//Builds the graph every run, or replays it once graph captured it
+static void
+runChainTP(Runtime * rt, taskGraph * graph, int depth)
+{
+    if(!graph)
+        rt->run(launch<chainTP>(depth, &Runtime::finalSignal));
+    else if(graph->captured())
+        rt->run(*graph, NULL);
+    else
+        rt->run(*graph, launch<chainTP>(depth, &Runtime::finalSignal));
+}
+
 int main(int argc, char *argv[])
 {
-    if (argc != 6)
+    if (argc != 6 && argc != 7)
     {
-        std::cout << "enter number of TP CD TPM CDM depth" << std::endl;
+        std::cout << "enter number of TP CD TPM CDM depth [graph]" << std::endl;
         return 0;
     }
     int tps = atoi(argv[1]);
@@ -99,14 +112,15 @@ int main(int argc, char *argv[])
         if (affin.generateMask())
         {
             Runtime * rt = new Runtime(&affin);
+            taskGraph * graph = (argc == 7 && !strcmp(argv[6], "graph")) ? new taskGraph : NULL;
 
             for (int i = 0; i < OUTER; i++) 
             {
-                rt->run(launch<chainTP> (depth, &Runtime::finalSignal));
+                runChainTP(rt, graph, depth);
                 for (int j = 0; j < INNER; j++) 
                 {
                     uint64_t startTime = getTime();
-                    rt->run(launch<chainTP> (depth, &Runtime::finalSignal));
+                    runChainTP(rt, graph, depth);
                     uint64_t endTime = getTime();
                     innerTime += endTime - startTime;
                 }
@@ -114,6 +128,7 @@ int main(int argc, char *argv[])
                 innerTime = 0;
             }
             std::cout << outerTime/OUTER << std::endl;
+            delete graph;
             delete rt;
         }
     }
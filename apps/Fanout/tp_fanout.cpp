@@ -29,6 +29,7 @@
 
 #include <iostream>
 #include <stdlib.h>
+#include <string.h>
 #include "darts.h"
 
 #define INNER 1000
@@ -105,11 +106,23 @@ public:
     }
 };
 
+//Builds the graph every run, or replays it once graph captured it
+static void
+runATP(Runtime * rt, taskGraph * graph, int fanout)
+{
+    if(!graph)
+        rt->run(launch<aTP>(fanout, &Runtime::finalSignal));
+    else if(graph->captured())
+        rt->run(*graph, NULL);
+    else
+        rt->run(*graph, launch<aTP>(fanout, &Runtime::finalSignal));
+}
+
 int main(int argc, char *argv[])
 {
-    if (argc != 6)
+    if (argc != 6 && argc != 7)
     {
-        std::cout << "enter number of TP CD TPM CDM Fanout" << std::endl;
+        std::cout << "enter number of TP CD TPM CDM Fanout [graph]" << std::endl;
         return 0;
     }
     int tps = atoi(argv[1]);
@@ -124,14 +137,15 @@ int main(int argc, char *argv[])
     if (affin.generateMask())
     {
         Runtime * rt = new Runtime(&affin);
+        taskGraph * graph = (argc == 7 && !strcmp(argv[6], "graph")) ? new taskGraph : NULL;
         
         for (int i = 0; i < OUTER; i++) 
         {
-            rt->run(launch<aTP>(fanout,&Runtime::finalSignal));
+            runATP(rt, graph, fanout);
             for (int j = 0; j < INNER; j++) 
             {
                 uint64_t startTime = getTime();
-                rt->run(launch<aTP>(fanout,&Runtime::finalSignal));
+                runATP(rt, graph, fanout);
                 uint64_t endTime = getTime();
                 innerTime += endTime - startTime;
             }
@@ -139,6 +153,7 @@ int main(int argc, char *argv[])
             innerTime = 0;
         }
         std::cout << outerTime/OUTER << std::endl;
+        delete graph;
         delete rt;
     }
     return 0;
@@ -43,6 +43,20 @@ public:
   virtual void fire(void);
 };
 
+//Used once the runtime is saturated, signals like a fib TP would
+static int
+fibSeq(int n)
+{
+    return (n < 2) ? n : fibSeq(n - 1) + fibSeq(n - 2);
+}
+
+static void
+fibSerial(int n, int * res, Codelet * toSig)
+{
+    (*res) = fibSeq(n);
+    toSig->decDep();
+}
+
 //This codelet is the continuation of the intiated split phase
 class cd2 : public Codelet
 {
@@ -53,8 +67,8 @@ public:
   virtual void fire(void);
 };
 
-//This is the Fib threaded proceduer
-class fib : public ThreadedProcedure
+//This is the Fib threaded proceduer, its frames come from the worker's slab
+class fib : public ThreadedProcedure, public slabAllocated
 {
 public:
     //These are the frame variables
@@ -102,8 +116,8 @@ cd1::fire(void)
     }
     else
     {
-        invoke<fib>(myFib,myFib->num-1,&myFib->x,&myFib->adder);
-        invoke<fib>(myFib,myFib->num-2,&myFib->y,&myFib->adder);
+        coarseInvoke<fib>(fibSerial,myFib,myFib->num-1,&myFib->x,&myFib->adder);
+        coarseInvoke<fib>(fibSerial,myFib,myFib->num-2,&myFib->y,&myFib->adder);
     }
 }
  
@@ -123,13 +137,15 @@ main(int argc, char *argv[])
     int result = 0;
     timespec start, end;
 
-    if (argc != 2)
+    if (argc != 2 && argc != 3)
     {
-        std::cout << "error need a num" << std::endl;
+        std::cout << "error need a num (and optionally a coarsening depth)" << std::endl;
         return 0;
     }
 
     fibnum = atoi(argv[1]);
+    if (argc == 3)
+        setCoarsenDepth(atoi(argv[2]));
 
     ThreadAffinity affin(3U, 1U, COMPACT, TPDYNAMIC, MCDYNAMIC);
     if (affin.generateMask())
@@ -141,6 +157,11 @@ main(int argc, char *argv[])
 
         std::cout << result << std::endl;
         std::cout << "Total Time Taken: " << seconds(end - start) << " sec" << std::endl;
+        
+        slabStats stats;
+        getSlabStats(stats);
+        std::cout << "Slab ";
+        stats.print();
     }
 
     return 0;
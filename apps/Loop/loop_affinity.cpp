@@ -0,0 +1,183 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <stdlib.h>
+#include "darts.h"
+#include "getClock.h"
+
+#define REPS 100
+
+using namespace darts;
+
+/*
+ * Sweeps over an array cut in one chunk per loop iteration, REPS times,
+ * with paraFor and codeletFor, each without and with a loopAffinity that
+ * keeps the chunks on the worker which swept them the run before. Prints
+ * the time of a run, how many chunks changed worker in the last run and,
+ * built with COUNT, the L2 data cache misses of all the runs.
+ */
+
+struct sweepArgs
+{
+    double * data;
+    unsigned int chunk;
+    unsigned int sweeps;
+};
+
+static void
+sweep(sweepArgs * args, unsigned int it)
+{
+    double * data = args->data + (size_t) it * args->chunk;
+    for(unsigned int s = 0; s < args->sweeps; s++)
+        for(unsigned int i = 0; i < args->chunk; i++)
+            data[i] = data[i] * 0.5 + 1.0;
+}
+
+class sweepLoop : public loop
+{
+public:
+    
+    class sweepCD : public Codelet
+    {
+    public:
+        sweepCD(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat):
+        Codelet(dep,res,myTP,stat){ }
+
+        void fire(void)
+        {
+            sweepLoop * myLoop = static_cast<sweepLoop*>(myTP_);
+            sweep(myLoop->args, myLoop->iter);
+            myLoop->toSignal->decDep();
+        }
+    };
+    
+    sweepArgs * args;
+    sweepCD scd;
+    sweepLoop(unsigned int it, Codelet * toSig, sweepArgs * ARGS):
+    loop(it,toSig),
+    args(ARGS),
+    scd(0,0,this,SHORTWAIT)
+    { 
+        add(&scd);
+    }
+};
+
+class paraTP : public ThreadedProcedure
+{
+public:    
+    paraFor<sweepLoop> sl;
+    paraTP(unsigned int chunks, sweepArgs * args, loopAffinity * affinity, Codelet * toSig):
+    ThreadedProcedure(),
+    sl(0,1,this,SHORTWAIT,toSig,chunks,args)
+    {
+        sl.setAffinity(affinity);
+        add(&sl);
+    }
+};
+
+class codeletTP : public ThreadedProcedure
+{
+public:    
+    codeletFor<sweepLoop> sl;
+    codeletTP(unsigned int chunks, sweepArgs * args, loopAffinity * affinity, Codelet * toSig):
+    ThreadedProcedure(),
+    sl(0,1,this,SHORTWAIT,toSig,chunks,args)
+    {
+        sl.setAffinity(affinity);
+        add(&sl);
+    }
+};
+
+static long long
+readMisses(ThreadAffinity * affin)
+{
+    long long total = 0;
+    for(unsigned int t = 0; t < affin->getNumTPS() + affin->getNumMCS(); t++)
+        total += affin->readCounter(t, 0);
+    return total;
+}
+
+template< class TP >
+static void
+timeLoop(const char * name, Runtime * rt, ThreadAffinity * affin, unsigned int chunks, sweepArgs * args, loopAffinity * affinity)
+{
+    //Warm up, and let the affinity see one run
+    rt->run(launch<TP>(chunks,args,affinity,&Runtime::finalSignal));
+    readMisses(affin);
+    uint64_t startTime = getTime();
+    for(int i = 0; i < REPS; i++)
+        rt->run(launch<TP>(chunks,args,affinity,&Runtime::finalSignal));
+    uint64_t time = (getTime() - startTime) / REPS;
+    std::cout << name << " " << time;
+    if(affinity)
+        std::cout << " moved " << affinity->getMoved();
+    if(affin->usePapi())
+        std::cout << " l2miss " << readMisses(affin);
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 8)
+    {
+        std::cout << "enter number of TP CD TPM CDM Chunks ChunkKB Sweeps" << std::endl;
+        return 0;
+    }
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    int tpm = atoi(argv[3]);
+    int cdm = atoi(argv[4]);
+    unsigned int chunks = atoi(argv[5]);
+    unsigned int chunkKB = atoi(argv[6]);
+    
+    sweepArgs args;
+    args.chunk = chunkKB * 1024 / sizeof(double);
+    args.sweeps = atoi(argv[7]);
+    args.data = new double[(size_t) chunks * args.chunk];
+    for(size_t i = 0; i < (size_t) chunks * args.chunk; i++)
+        args.data[i] = 1.0;
+    
+    ThreadAffinity affin(cds, tps, SPREAD, tpm, cdm);
+#ifdef COUNT
+    affin.initPapi(false, true, false, false, false);
+#endif
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        loopAffinity paraAffinity;
+        loopAffinity codeletAffinity;
+        
+        timeLoop<paraTP>("paraFor", rt, &affin, chunks, &args, NULL);
+        timeLoop<paraTP>("paraFor+affinity", rt, &affin, chunks, &args, &paraAffinity);
+        timeLoop<codeletTP>("codeletFor", rt, &affin, chunks, &args, NULL);
+        timeLoop<codeletTP>("codeletFor+affinity", rt, &affin, chunks, &args, &codeletAffinity);
+        delete rt;
+    }
+    delete [] args.data;
+    return 0;
+}
@@ -0,0 +1,268 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <stdlib.h>
+#include "darts.h"
+
+#define CHUNK 1024
+#define ROUNDS 2
+
+using namespace darts;
+
+/*
+ * Runs the same loop ROUNDS times in one TP, each iteration feeding three
+ * reductions: a scalar sum, an array sum long enough for the parallel
+ * combine tree and the smallest and largest value with a user-defined
+ * type and combine. Every round is checked against the same reductions
+ * done serially, so a partial not given back its identity shows up in
+ * the second round.
+ */
+
+static uint64_t
+value(uint64_t j)
+{
+    return (j * 2654435761U) % 1000;
+}
+
+struct bounds
+{
+    uint64_t lo;
+    uint64_t hi;
+    bounds(uint64_t Lo = ~0ULL, uint64_t Hi = 0): lo(Lo), hi(Hi) { }
+};
+
+struct widen
+{
+    bounds operator()(const bounds & a, const bounds & b) const
+    {
+        return bounds((a.lo < b.lo) ? a.lo : b.lo, (a.hi > b.hi) ? a.hi : b.hi);
+    }
+};
+
+struct expected
+{
+    uint64_t sum;
+    uint64_t * array;
+    unsigned int length;
+    bounds range;
+};
+
+enum { SUM, ARRAY, RANGE };
+
+class reduceTP;
+
+class reduceLoop : public loop
+{
+public:
+    
+    class reduceCD : public Codelet
+    {
+    public:
+        reduceCD(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat):
+        Codelet(dep,res,myTP,stat){ }
+
+        void fire(void);
+    };
+    
+    reduceTP * owner;
+    unsigned int kind;
+    reduceCD rcd;
+    reduceLoop(unsigned int it, Codelet * toSig, reduceTP * Owner, unsigned int Kind):
+    loop(it,toSig),
+    owner(Owner),
+    kind(Kind),
+    rcd(0,0,this,SHORTWAIT)
+    { 
+        add(&rcd);
+    }
+};
+
+class reduceTP : public ThreadedProcedure
+{
+public:
+    
+    //Checks a round against the serial results and starts the next one
+    class checkCD : public Codelet
+    {
+    public:
+        checkCD(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat):
+        Codelet(dep,res,myTP,stat){ }
+
+        void fire(void);
+    };
+    
+    class startCD : public Codelet
+    {
+    public:
+        startCD(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat):
+        Codelet(dep,res,myTP,stat){ }
+
+        void fire(void)
+        {
+            reduceTP * myTP = static_cast<reduceTP*>(myTP_);
+            resetCodelet();
+            myTP->sumLoop.decDep();
+            myTP->arrayLoop.decDep();
+            myTP->rangeLoop.decDep();
+        }
+    };
+    
+    expected * expect;
+    unsigned int * errors;
+    unsigned int round;
+    Codelet * toSignal;
+    checkCD check;
+    startCD start;
+    reduction<uint64_t> sum;
+    reduction<uint64_t> array;
+    reduction<bounds, widen> range;
+    paraFor<reduceLoop> sumLoop;
+    paraFor<reduceLoop> arrayLoop;
+    paraFor<reduceLoop> rangeLoop;
+    
+    reduceTP(unsigned int iterations, expected * Expect, unsigned int * Errors, Codelet * toSig):
+    ThreadedProcedure(),
+    expect(Expect),
+    errors(Errors),
+    round(0),
+    toSignal(toSig),
+    check(3,3,this,SHORTWAIT),
+    start(0,1,this,SHORTWAIT),
+    sum(1,1,this,SHORTWAIT,&check,0),
+    array(1,1,this,SHORTWAIT,&check,0,Expect->length),
+    range(1,1,this,SHORTWAIT,&check,bounds()),
+    sumLoop(1,1,this,SHORTWAIT,&sum,iterations,this,SUM),
+    arrayLoop(1,1,this,SHORTWAIT,&array,iterations,this,ARRAY),
+    rangeLoop(1,1,this,SHORTWAIT,&range,iterations,this,RANGE)
+    {
+        add(&start);
+    }
+};
+
+void
+reduceLoop::reduceCD::fire(void)
+{
+    reduceLoop * myLoop = static_cast<reduceLoop*>(myTP_);
+    reduceTP * owner = myLoop->owner;
+    uint64_t first = (uint64_t) myLoop->iter * CHUNK;
+    if(myLoop->kind == SUM)
+    {
+        uint64_t total = 0;
+        for(uint64_t j = first; j < first + CHUNK; j++)
+            total += value(j);
+        owner->sum.accumulate(total);
+    }
+    else if(myLoop->kind == ARRAY)
+    {
+        uint64_t * mine = owner->array.localArray();
+        for(unsigned int k = 0; k < owner->array.getLength(); k++)
+            mine[k] += (myLoop->iter + k) % 7;
+    }
+    else
+    {
+        for(uint64_t j = first; j < first + CHUNK; j++)
+            owner->range.accumulate(bounds(value(j), value(j)));
+    }
+    myLoop->toSignal->decDep();
+}
+
+void
+reduceTP::checkCD::fire(void)
+{
+    reduceTP * myTP = static_cast<reduceTP*>(myTP_);
+    expected * expect = myTP->expect;
+    resetCodelet();
+    if(myTP->sum.result() != expect->sum)
+    {
+        std::cout << "round " << myTP->round << " sum " << myTP->sum.result() << " expected " << expect->sum << std::endl;
+        (*myTP->errors)++;
+    }
+    for(unsigned int k = 0; k < expect->length; k++)
+        if(myTP->array.resultArray()[k] != expect->array[k])
+        {
+            std::cout << "round " << myTP->round << " array[" << k << "] " << myTP->array.resultArray()[k]
+                      << " expected " << expect->array[k] << std::endl;
+            (*myTP->errors)++;
+            break;
+        }
+    if(myTP->range.result().lo != expect->range.lo || myTP->range.result().hi != expect->range.hi)
+    {
+        std::cout << "round " << myTP->round << " range " << myTP->range.result().lo << " " << myTP->range.result().hi
+                  << " expected " << expect->range.lo << " " << expect->range.hi << std::endl;
+        (*myTP->errors)++;
+    }
+    if(++myTP->round < ROUNDS)
+        myTP->start.decDep();
+    else
+        myTP->toSignal->decDep();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 6)
+    {
+        std::cout << "enter number of TP CD TPM CDM Iterations" << std::endl;
+        return 0;
+    }
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    int tpm = atoi(argv[3]);
+    int cdm = atoi(argv[4]);
+    unsigned int iterations = atoi(argv[5]);
+    
+    //Long enough for the parallel combine with any number of workers
+    expected expect;
+    expect.length = REDUCE_PARALLEL_MIN;
+    expect.array = new uint64_t[expect.length];
+    expect.sum = 0;
+    for(uint64_t j = 0; j < (uint64_t) iterations * CHUNK; j++)
+    {
+        expect.sum += value(j);
+        expect.range = widen()(expect.range, bounds(value(j), value(j)));
+    }
+    for(unsigned int k = 0; k < expect.length; k++)
+    {
+        expect.array[k] = 0;
+        for(unsigned int it = 0; it < iterations; it++)
+            expect.array[k] += (it + k) % 7;
+    }
+    
+    unsigned int errors = 0;
+    ThreadAffinity affin(cds, tps, SPREAD, tpm, cdm);
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        uint64_t startTime = getTime();
+        rt->run(launch<reduceTP>(iterations,&expect,&errors,&Runtime::finalSignal));
+        uint64_t time = getTime() - startTime;
+        std::cout << ((errors) ? "failed " : "ok ") << time << std::endl;
+        delete rt;
+    }
+    delete [] expect.array;
+    return (errors) ? 1 : 0;
+}
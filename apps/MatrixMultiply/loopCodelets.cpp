@@ -38,8 +38,10 @@
 #define SCRATCH 524288
 
 using namespace darts;
+
+//Multiplies row block i of A, copied in A, by column block j of B into C
 void
-tileMult::fire(void)
+multTile(mmArgs * args, matrix * A, int i, int j)
 {
     INT tempISize = (i + 1 == args->iCut) ? (args->iTile + args->iMod) : (args->iTile);
     INT tempJSize = (j + 1 == args->jCut) ? (args->jTile + args->jMod) : (args->jTile);
@@ -64,6 +66,11 @@ tileMult::fire(void)
 #else
     copyMatrix(args->c, &C, j * args->jTile, i * args->iTile);
 #endif
-    
+}
+
+void
+tileMult::fire(void)
+{
+    multTile(args, A, i, j);
     myLoop->toSignal->decDep();
 }
@@ -31,6 +31,8 @@
 #include "matrix.h"
 using namespace darts;
 
+void multTile(mmArgs * args, matrix * A, int i, int j);
+
 class tileMult : public Codelet
 {
 private:
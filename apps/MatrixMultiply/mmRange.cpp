@@ -0,0 +1,124 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "darts.h"
+#include "getClock.h"
+#include "loopTPs.h"
+#include "rangeTPs.h"
+#include "matrix.h"
+
+#define INNERLOOP 10
+#define OUTERLOOP 10
+
+using namespace darts;
+
+/*
+ * Times the paraFor/codeletFor tiling of mmTime against the same tiles run
+ * by a rangeFor under each loop schedule, and checks every result against
+ * the one of mmTile.
+ */
+
+static const char * schedNames[] = { "serial", "static", "dynamic", "guided", "lazy" };
+
+static uint64_t
+timeTile(Runtime * rt, matrix * A, matrix * B, matrix * C, int size, int iCut, int jCut)
+{
+    uint64_t total = 0;
+    for(int i=0;i<OUTERLOOP;i++)
+    {
+        C->resetMatrix();
+        uint64_t startTime = getTime();
+        for(int j=0;j<INNERLOOP;j++)
+            rt->run(launch<mmTile>(A,B,C,size,size,size,iCut,jCut,&Runtime::finalSignal));
+        total += (getTime() - startTime) / INNERLOOP;
+    }
+    return total / OUTERLOOP;
+}
+
+static uint64_t
+timeRange(Runtime * rt, matrix * A, matrix * B, matrix * C, int size, int iCut, int jCut, loopSchedule sched, unsigned int grain)
+{
+    uint64_t total = 0;
+    for(int i=0;i<OUTERLOOP;i++)
+    {
+        C->resetMatrix();
+        uint64_t startTime = getTime();
+        for(int j=0;j<INNERLOOP;j++)
+            rt->run(launch<mmRange>(A,B,C,size,size,size,iCut,jCut,sched,grain,&Runtime::finalSignal));
+        total += (getTime() - startTime) / INNERLOOP;
+    }
+    return total / OUTERLOOP;
+}
+
+int main(int argc, char * argv[])
+{
+    if (argc != 9)
+    {
+        std::cout << "enter number of TP CD TPM CDM size iCut jCut grain" << std::endl;
+        return 0;
+    }
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    int tpm = atoi(argv[3]);
+    int cdm = atoi(argv[4]);
+    int size = atoi(argv[5]);
+    int iCut = atoi(argv[6]);
+    int jCut = atoi(argv[7]);
+    unsigned int grain = atoi(argv[8]);
+    
+    ThreadAffinity affin(cds, tps, SPREAD, tpm, cdm);
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        
+        matrix A(size,size);
+        matrix B(size,size);
+        matrix C(size,size);
+        matrix ref(size,size);
+
+        initRandomMatrix(&A);
+        initRandomMatrix(&B);
+        
+        rt->run(launch<mmTile>(&A,&B,&ref,size,size,size,iCut,jCut,&Runtime::finalSignal));
+        std::cout << "tile " << timeTile(rt,&A,&B,&C,size,iCut,jCut) << std::endl;
+        
+        for(int s = LOOP_SERIAL; s <= LOOP_LAZY; s++)
+        {
+            uint64_t time = timeRange(rt,&A,&B,&C,size,iCut,jCut,(loopSchedule) s,grain);
+            std::cout << schedNames[s] << " " << time;
+            if(!compare(&C,&ref))
+                std::cout << " wrong result";
+            std::cout << std::endl;
+        }
+        delete rt;
+    }
+    return 0;
+}
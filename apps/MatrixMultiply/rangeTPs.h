@@ -0,0 +1,165 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include "darts.h"
+#include "loopCodelets.h"
+#include "matrix.h"
+using namespace darts;
+
+/*
+ * Same tiling as mmTile, but the iCut*jCut tiles are one flat rangeFor:
+ * tile t is row block t/jCut and column block t%jCut, and each loop TP
+ * multiplies a range of tiles picked by the loop schedule.
+ */
+class mmRange : public ThreadedProcedure
+{
+public:
+
+    class tileRange : public rangeLoop
+    {
+    public:
+
+        class tiles : public Codelet
+        {
+        public:
+            tiles(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat) :
+            Codelet(dep, res, myTP, stat) { }
+
+            virtual void fire(void)
+            {
+                tileRange * myRange = static_cast<tileRange*>(myTP_);
+                mmArgs * args = myRange->args;
+                matrix * tempA = 0;
+                int row = -1;
+                for(unsigned int t = myRange->start; t < myRange->end; t++)
+                {
+                    int i = t / args->jCut;
+                    //Copy the row block of A once for the tiles of a row
+                    if(i != row)
+                    {
+                        delete tempA;
+                        tempA = new matrix(args->a, i*(args->iTile), 0,
+                                (i + 1 == args->iCut) ? (args->iMod + args->iTile) : (args->iTile),
+                                args->msk);
+                        row = i;
+                    }
+                    multTile(args, tempA, i, t % args->jCut);
+                }
+                delete tempA;
+                myRange->toSignal->decDep();
+            }
+        };
+
+        mmArgs * args;
+        tiles mul;
+
+        tileRange(unsigned int Start, unsigned int End, Codelet * toSig, mmArgs * ARGS) :
+        rangeLoop(Start, End, toSig),
+        args(ARGS),
+        mul(0, 0, this, SHORTWAIT)
+        {
+            add(&mul);
+        }
+    };
+
+    mmArgs args;
+    rangeFor<tileRange> tl;
+
+    mmRange(matrix * A, matrix * B, matrix * C, int MSI, int MSJ, int MSK, int IC, int JC,
+            loopSchedule sched, unsigned int grain, Codelet * toSig) :
+    args(A, B, C,
+    MSI, MSJ, MSK,
+    IC, JC),
+    tl(0, 1, this, SHORTWAIT, toSig, IC*JC, sched, grain, &args)
+    {
+        add(&tl);
+    }
+};
+
+/*
+ * Same tiling as mmTile, but the iCut x jCut grid of tiles is a blockedFor:
+ * each loop TP multiplies a box of iGrain x jGrain tiles, and the boxes
+ * sharing rows of A and columns of B run on the same cluster.
+ */
+class mmBlock : public ThreadedProcedure
+{
+public:
+
+    class tileBlock : public blockLoop
+    {
+    public:
+
+        class tiles : public Codelet
+        {
+        public:
+            tiles(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat) :
+            Codelet(dep, res, myTP, stat) { }
+
+            virtual void fire(void)
+            {
+                tileBlock * myBlock = static_cast<tileBlock*>(myTP_);
+                mmArgs * args = myBlock->args;
+                const blockRange & range = myBlock->range;
+                for(unsigned int i = range.begin(0); i < range.end(0); i++)
+                {
+                    //Copy the row block of A once for the tiles of a row
+                    matrix tempA(args->a, i*(args->iTile), 0,
+                            ((int) i + 1 == args->iCut) ? (args->iMod + args->iTile) : (args->iTile),
+                            args->msk);
+                    for(unsigned int j = range.begin(1); j < range.end(1); j++)
+                        multTile(args, &tempA, i, j);
+                }
+                myBlock->toSignal->decDep();
+            }
+        };
+
+        mmArgs * args;
+        tiles mul;
+
+        tileBlock(const blockRange & Range, Codelet * toSig, mmArgs * ARGS) :
+        blockLoop(Range, toSig),
+        args(ARGS),
+        mul(0, 0, this, SHORTWAIT)
+        {
+            add(&mul);
+        }
+    };
+
+    mmArgs args;
+    blockedFor<tileBlock> tl;
+
+    mmBlock(matrix * A, matrix * B, matrix * C, int MSI, int MSJ, int MSK, int IC, int JC,
+            unsigned int iGrain, unsigned int jGrain, Codelet * toSig) :
+    args(A, B, C,
+    MSI, MSJ, MSK,
+    IC, JC),
+    tl(0, 1, this, SHORTWAIT, toSig, blockRange(0, IC, iGrain, 0, JC, jGrain), &args)
+    {
+        add(&tl);
+    }
+};
@@ -0,0 +1,105 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef MERGEDC_H
+#define	MERGEDC_H
+
+#include "darts.h"
+
+void quicksort(int * array, int left, int right);
+
+//Mergesort for the divideConquer skeleton, out ends up sorted and in is
+//used as scratch, both hold the same values to begin with
+class mergeProblem
+{
+public:
+    static const unsigned int arity = 2;
+    
+    int * in;
+    int * out;
+    int size;
+    int base;
+    
+    mergeProblem(void):
+    in(0),
+    out(0),
+    size(0),
+    base(1)
+    { }
+    
+    mergeProblem(int * IN, int * OUT, int SIZE, int BASE):
+    in(IN),
+    out(OUT),
+    size(SIZE),
+    base(BASE)
+    { }
+    
+    bool
+    leaf(void)
+    {
+        return size <= base;
+    }
+    
+    void
+    solve(void)
+    {
+        quicksort(out, 0, size - 1);
+    }
+    
+    //The halves are sorted into our in, then merged into our out
+    void
+    split(mergeProblem * parts)
+    {
+        int half = size / 2;
+        parts[0] = mergeProblem(out, in, half, base);
+        parts[1] = mergeProblem(out + half, in + half, size - half, base);
+    }
+    
+    void
+    combine(mergeProblem *)
+    {
+        int half = size / 2;
+        int j = 0;
+        int k = half;
+        for(int i = 0; i < size; i++)
+        {
+            if(k >= size || (j < half && in[j] < in[k]))
+                out[i] = in[j++];
+            else
+                out[i] = in[k++];
+        }
+    }
+    
+    void
+    serial(void)
+    {
+        darts::dcRecurse(*this);
+    }
+};
+
+#endif	/* MERGEDC_H */
@@ -35,7 +35,7 @@
 
 using namespace darts;
 
-class mergeSort : public ThreadedProcedure
+class mergeSort : public ThreadedProcedure, public slabAllocated
 {
 public:
 
@@ -84,7 +84,7 @@ public:
     }
 };
 
-class mergeBase : public ThreadedProcedure
+class mergeBase : public ThreadedProcedure, public slabAllocated
 {
 public:
 
@@ -191,7 +191,7 @@ public:
     }
 };
 
-class quickSort : public ThreadedProcedure
+class quickSort : public ThreadedProcedure, public slabAllocated
 {
 public:
 
@@ -28,8 +28,10 @@
 
 #include <iostream>
 #include <stdlib.h>
+#include <string.h>
 #include "darts.h"
 #include "mergeUnrolledTP.h"
+#include "mergeDC.h"
 #define INNER 10
 #define OUTER 10
 
@@ -44,7 +46,19 @@ void initUnrolledMerge(int size, int * in, int * out)
     }
 }
 
-uint64_t mergeUnrolledTest(int innerloop, int outerloop, Runtime * rt, int size, int base)
+//Sorts with the unrolled TPs or, when dc is set, the divideConquer skeleton
+void runMerge(Runtime * rt, int * in, int * out, int size, int base, bool dc)
+{
+    if(dc)
+    {
+        mergeProblem problem(in,out,size,base);
+        rt->run(launch<divideConquer<mergeProblem> >(&problem,&Runtime::finalSignal) );
+    }
+    else
+        rt->run(launch<mergeSort>(in,out,size,base,&Runtime::finalSignal) );
+}
+
+uint64_t mergeUnrolledTest(int innerloop, int outerloop, Runtime * rt, int size, int base, bool dc)
 {
     int * in = new int[size];
     int * out = new int[size];
@@ -57,13 +71,13 @@ uint64_t mergeUnrolledTest(int innerloop, int outerloop, Runtime * rt, int size,
     for(int i=0;i<outerloop;i++)
     {
         initUnrolledMerge(size,in,out);
-        rt->run(launch<mergeSort>(in,out,size,base,&Runtime::finalSignal) );
+        runMerge(rt,in,out,size,base,dc);
 
         for(int i=0;i<innerloop;i++)
         {
             initUnrolledMerge(size,in,out);
             uint64_t startTime = getTime();
-            rt->run(launch<mergeSort>(in,out,size,base,&Runtime::finalSignal) );
+            runMerge(rt,in,out,size,base,dc);
             uint64_t endTime = getTime();
             innerTime+=endTime-startTime;
         }
@@ -75,13 +89,13 @@ uint64_t mergeUnrolledTest(int innerloop, int outerloop, Runtime * rt, int size,
     return outerTime/outerloop;
 }
 
-bool mergeUnrolledCheck(Runtime * rt, int size, int base)
+bool mergeUnrolledCheck(Runtime * rt, int size, int base, bool dc)
 {
     int * in = new int[size];
     int * out = new int[size];
     
     initUnrolledMerge(size,in,out);
-    rt->run( launch<mergeSort>(in,out,size,base,&Runtime::finalSignal) );
+    runMerge(rt,in,out,size,base,dc);
 
     for (int i = 1; i < size; i++)
     {
@@ -97,9 +111,9 @@ bool mergeUnrolledCheck(Runtime * rt, int size, int base)
 
 int main(int argc, char * argv[])
 {
-    if (argc != 7)
+    if (argc != 7 && argc != 8)
     {
-        std::cout << "enter number of TP CD TPM CDM size base" << std::endl;
+        std::cout << "enter number of TP CD TPM CDM size base [dc]" << std::endl;
         return 0;
     }
     int tps = atoi(argv[1]);
@@ -108,12 +122,13 @@ int main(int argc, char * argv[])
     int cdm = atoi(argv[4]);
     int size = atoi(argv[5]);
     int base = atoi(argv[6]);
+    bool dc = (argc == 8 && !strcmp(argv[7], "dc"));
     
     ThreadAffinity affin(cds, tps, SPREAD, tpm, cdm);
     if (affin.generateMask())
     {
         Runtime * rt = new Runtime(&affin);
-        std::cout << mergeUnrolledTest(INNER, OUTER, rt, size, base) << std::endl;
+        std::cout << mergeUnrolledTest(INNER, OUTER, rt, size, base, dc) << std::endl;
     }
     
     return 0;
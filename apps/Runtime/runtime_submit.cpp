@@ -0,0 +1,251 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include <stdlib.h>
+#include <stdint.h>
+#include "getClock.h"
+#include "darts.h"
+
+//Requests each client keeps in flight in the throughput phase
+#define WINDOW 8
+
+using namespace darts;
+
+class check : public Codelet
+{
+public:
+  check(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat):
+  Codelet(dep,res,myTP,stat) { }
+  
+  virtual void fire(void);
+};
+
+class adder : public Codelet
+{
+public:
+  adder(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat):
+  Codelet(dep,res,myTP,stat) { }
+  
+  virtual void fire(void);
+};
+
+//A small request: fib(num) as a graph of TPs
+class fib : public ThreadedProcedure
+{
+public:
+    int num;
+    int x;
+    int y;
+    int * result;
+    check checkCD;
+    adder adderCD;
+    Codelet * toSignal;
+    
+    fib(int n, int * res, Codelet * toSig):
+    ThreadedProcedure(),
+    num(n),
+    x(0),
+    y(0),
+    result(res),
+    checkCD(0,0,this,SHORTWAIT),
+    adderCD(2,2,this,LONGWAIT),
+    toSignal(toSig) 
+    {  
+        add(&checkCD); 
+    }
+};
+
+void
+check::fire(void)
+{
+    fib * myFib = static_cast<fib*>(myTP_);
+    if(myFib->num<2)
+    {
+        (*myFib->result) = myFib->num;
+        myFib->toSignal->decDep();
+    }
+    else
+    {
+        invoke<fib>(myFib,myFib->num-1,&myFib->x,&myFib->adderCD);
+        invoke<fib>(myFib,myFib->num-2,&myFib->y,&myFib->adderCD);
+    }
+}
+ 
+void 
+adder::fire(void)
+{ 
+    fib * myFib = static_cast<fib*>(myTP_);    
+    (*myFib->result) = myFib->x + myFib->y;
+    myFib->toSignal->decDep();
+}
+
+struct client
+{
+    Runtime * rt;
+    int num;
+    int requests;
+    int expect;
+    bool window;
+    int errors;
+    std::vector<uint64_t> latency;
+};
+
+//Closed loop: one request at a time, measures the submit to wake up latency
+//Window: keeps WINDOW requests in flight, measures throughput
+void * clientThread(void * args)
+{
+    client * me = static_cast<client*>(args);
+    int depth = (me->window) ? WINDOW : 1;
+    Completion done[WINDOW];
+    int result[WINDOW];
+    uint64_t start[WINDOW];
+    
+    for(int i = 0; i < me->requests; i += depth)
+    {
+        int inFlight = std::min(depth, me->requests - i);
+        for(int j = 0; j < inFlight; j++)
+        {
+            done[j].reset();
+            start[j] = getTime();
+            me->rt->submit(launch<fib>(me->num, &result[j], &done[j]));
+        }
+        for(int j = 0; j < inFlight; j++)
+        {
+            done[j].wait();
+            me->latency.push_back(getTime() - start[j]);
+            if(result[j] != me->expect)
+                me->errors++;
+        }
+    }
+    return 0;
+}
+
+uint64_t runClients(Runtime * rt, int clients, int requests, int num, bool window, std::vector<uint64_t> & latency, int & errors)
+{
+    int expect = 0, prev = 1;
+    for(int i = 0; i < num; i++)
+    {
+        int next = expect + prev;
+        prev = expect;
+        expect = next;
+    }
+    
+    std::vector<client> args(clients);
+    std::vector<Thread> threads(clients);
+    uint64_t startTime = getTime();
+    for(int i = 0; i < clients; i++)
+    {
+        args[i].rt = rt;
+        args[i].num = num;
+        args[i].requests = requests;
+        args[i].expect = expect;
+        args[i].window = window;
+        args[i].errors = 0;
+        threads[i].resetArgument(&args[i]);
+        threads[i].resetFunction(clientThread);
+        threads[i].run();
+    }
+    for(int i = 0; i < clients; i++)
+        threads[i].join();
+    uint64_t endTime = getTime();
+    
+    latency.clear();
+    errors = 0;
+    for(int i = 0; i < clients; i++)
+    {
+        latency.insert(latency.end(), args[i].latency.begin(), args[i].latency.end());
+        errors += args[i].errors;
+    }
+    std::sort(latency.begin(), latency.end());
+    return endTime - startTime;
+}
+
+void report(const char * name, uint64_t time, std::vector<uint64_t> & latency, int errors)
+{
+    uint64_t sum = 0;
+    for(size_t i = 0; i < latency.size(); i++)
+        sum += latency[i];
+    size_t n = latency.size();
+    std::cout << name 
+              << " requests/s: " << (n * 1000000000.0) / time
+              << " avg: " << sum / n << " ns"
+              << " p50: " << latency[n / 2] << " ns"
+              << " p99: " << latency[(n * 99) / 100] << " ns"
+              << " max: " << latency[n - 1] << " ns"
+              << " errors: " << errors << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 6)
+    {
+        std::cout << "enter number of TPs CDs clients requests fib" << std::endl;
+        return 0;
+    }
+
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    int clients = atoi(argv[3]);
+    int requests = atoi(argv[4]);
+    int num = atoi(argv[5]);
+    
+    ThreadAffinity affin(cds, tps, COMPACT, TPSTATIC, MCSTANDARD);
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        std::vector<uint64_t> latency;
+        int errors = 0;
+        
+        //Baseline: run serializes the requests on the calling thread
+        int result = 0;
+        uint64_t startTime = getTime();
+        for(int i = 0; i < clients * requests; i++)
+        {
+            uint64_t reqStart = getTime();
+            rt->run(launch<fib>(num, &result, &Runtime::finalSignal));
+            latency.push_back(getTime() - reqStart);
+        }
+        uint64_t time = getTime() - startTime;
+        std::sort(latency.begin(), latency.end());
+        report("run    ", time, latency, 0);
+        
+        time = runClients(rt, clients, requests, num, false, latency, errors);
+        report("submit ", time, latency, errors);
+        
+        time = runClients(rt, clients, requests, num, true, latency, errors);
+        report("window ", time, latency, errors);
+        
+        rt->stop();
+        delete rt;
+    }
+    else
+        std::cout << "Could not generate mask " << tps << " " << cds << std::endl;
+    return 0;
+}
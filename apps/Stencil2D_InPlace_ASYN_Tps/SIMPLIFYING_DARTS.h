@@ -25,6 +25,7 @@
 using namespace darts;
 
 #define DEF_TP(TPName) struct TPName : public ThreadedProcedure
+#define DEF_PERSISTENT_TP(TPName) struct TPName : public persistentTP
 
 #define DEF_CODELET_ITER(name,deps,wait)               \
 class name : public darts::Codelet                     \
@@ -71,6 +72,7 @@ struct name : public darts::Codelet                    \
 #define SYNC(field)        (*frame).field.decDep()
 #define ADD(cd_name)       frame->cd_name.add()
 #define RESET(cd_name)	   frame->cd_name.resetCodelet()
+#define ARRIVE()           frame->arrive()
 
 #define DARTS_EXIT() Runtime::finalSignal.decDep()
 #define EXIT_TP() return
@@ -37,10 +37,10 @@ DEF_TP(Stencil2DPartition)
 	{
 		add(&nChunks);
 		for(size_t i=0;i<g_nSU;++i){
-			nTpSync[i*4]=ts;
-			nTpSync[i*4+1]=ts;
-			nTpSync[i*4+2]=ts;
-			nTpSync[i*4+3]=ts;
+			nTpSync[i*4]=0;
+			nTpSync[i*4+1]=0;
+			nTpSync[i*4+2]=0;
+			nTpSync[i*4+3]=0;
 
 		}
 	}
@@ -23,10 +23,10 @@ void Stencil2DRowCheckUp::fire(void){
 	uint32_t n_tp = FRAME(nTp);
 	uint64_t * n_tpsync = FRAME(nTpSync);
 
-//	std::cout <<"TP: " <<n_tp <<" checkUp " << n_tpsync[4*n_tp] <<","<<n_tpsync[4*n_tp-3]<<std::endl;
-	if(n_tpsync[4*n_tp]==n_tpsync[4*n_tp-3]){
+	//the upper TP finished the previous time step, its last line is ready to be copied
+	if(n_tpsync[4*(n_tp-1)]>=frame->getEpoch()){
 		SYNC(copyUp[0]);
-//		std::cout <<"TP: " <<n_tp <<" checkUp finish! "  <<std::endl;	
+		ARRIVE();
 	}else{
 		add(&FRAME(checkUp));
 	}
@@ -40,11 +40,10 @@ void Stencil2DRowCheckDown::fire(void){
 	uint32_t n_tp = FRAME(nTp);
 	uint64_t * n_tpsync = FRAME(nTpSync);
 
-//	std::cout <<"TP: " <<n_tp <<" checkDown " <<n_tpsync[4*n_tp+1] <<", "<<n_tpsync[4*n_tp+4] <<std::endl;
-
-	if(n_tpsync[4*n_tp+1]==n_tpsync[4*n_tp+4]){
+	//the lower TP finished the previous time step, its first line is ready to be copied
+	if(n_tpsync[4*(n_tp+1)]>=frame->getEpoch()){
 		SYNC(copyDown[nRowsCut-1]);
-//		std::cout <<"TP: " <<n_tp <<" CheckDown finish! " <<std::endl;	
+		ARRIVE();
 	}else{
 		add(&FRAME(checkDown));
 	}
@@ -58,11 +57,10 @@ void Stencil2DRowComputeUp::fire(void){
 	uint32_t n_tp = FRAME(nTp);
 	uint64_t * n_tpsync = FRAME(nTpSync);
 
-//	std::cout <<"TP: " <<n_tp <<" computeUp " <<n_tpsync[4*n_tp]<< ", "<<n_tpsync[4*n_tp-1] <<std::endl;
-
-	if(n_tpsync[4*n_tp]==n_tpsync[4*n_tp-1]){
+	//the upper TP copied our first line for this time step
+	if(n_tpsync[4*(n_tp-1)+2]>frame->getEpoch()){
 		SYNC(compute[0]);
-//		std::cout <<"TP: " <<n_tp <<" computeUp finish! "  <<std::endl;	
+		ARRIVE();
 	}else{
 		add(&FRAME(computeUp));
 	}
@@ -76,11 +74,10 @@ void Stencil2DRowComputeDown::fire(void){
 	uint32_t n_tp = FRAME(nTp);
 	uint64_t * n_tpsync = FRAME(nTpSync);
 
-//	std::cout <<"TP: " <<n_tp <<" computeDown " <<n_tpsync[4*n_tp+1]<<", "<<n_tpsync[4*n_tp+6]<<std::endl;
-
-	if(n_tpsync[4*n_tp+1]==n_tpsync[4*n_tp+6]){
-			SYNC(compute[nRowsCut-1]);
-//			std::cout <<"TP: " <<n_tp <<" ComputeDown finish!"  <<std::endl;	
+	//the lower TP copied our last line for this time step
+	if(n_tpsync[4*(n_tp+1)+1]>frame->getEpoch()){
+		SYNC(compute[nRowsCut-1]);
+		ARRIVE();
 	}else{
 		add(&FRAME(computeDown));
 	}
@@ -95,6 +92,7 @@ void Stencil2DRowLoopPre::fire(void){
 	uint64_t Id = getID();
 	SYNC(copyUp[Id]);
 	SYNC(copyDown[Id]);
+	ARRIVE();
 
 	EXIT_TP();
 }
@@ -110,33 +108,21 @@ void Stencil2DRowLoopCopyUp::fire(void)
 	const uint64_t n_rows = FRAME(nRows); // matrix M row
 	const uint64_t n_cols = FRAME(nCols); // Matrix N column
 	uint64_t bm=n_rows - 2;//blockM
-	//uint64_t Id = getID();
 	double *share = FRAME(shareRows+Id*2*n_cols);
 	const uint64_t rows_ini = bm / nRowsCut; // initially, the total number of rows in every nRowsCut
 	uint64_t pos = Id*rows_ini * n_cols; 
 	
 	copyLine_stencil2d(pos,initial,share,n_cols);//copy shared upper line between blocks (up+lower lines)
-	
-	RESET(copyUp[Id]);	
-	//SYNC(compute[Id]);
-	//EXIT_TP();
-
-
-	uint64_t *ts = FRAME(tSteps);
-	uint32_t n_tp = FRAME(nTp);
-	uint64_t * n_tpsync = FRAME(nTpSync);
 
-//	std::cout <<"TP: "<<n_tp<<" ID: " << Id <<" copyUp finish! "<<std::endl;	
 	if(Id==0){
-		n_tpsync[4*n_tp+2]=ts[Id];
-		if((n_tp==0)||(n_tpsync[4*n_tp+2]==FRAME(timeStep))){
-			SYNC(compute[Id]);
-		}
-		SYNC(compute[Id]);
+		uint32_t n_tp = FRAME(nTp);
+		uint64_t * n_tpsync = FRAME(nTpSync);
+		n_tpsync[4*n_tp+1]=frame->getEpoch()+1;
 	}else{
-		SYNC(compute[Id]);
 		SYNC(compute[Id-1]);
 	}
+	SYNC(compute[Id]);
+	ARRIVE();
 	EXIT_TP();
 }
 
@@ -151,7 +137,6 @@ void Stencil2DRowLoopCopyDown::fire(void)
 	const uint64_t n_rows = FRAME(nRows); // matrix M row
 	const uint64_t n_cols = FRAME(nCols); // Matrix N column
 	uint64_t bm=n_rows - 2;//blockM
-//	uint64_t Id = getID();
 	double *share = FRAME(shareRows+Id*2*n_cols);
 	const uint64_t rows_ini = bm / nRowsCut; // initially, the total number of rows in every nRowsCut
 	uint64_t bm_final = ((Id==(nRowsCut-1))? (bm%nRowsCut):0) + rows_ini;
@@ -159,28 +144,15 @@ void Stencil2DRowLoopCopyDown::fire(void)
 	
 	copyLine_stencil2d(pos,initial,share+n_cols,n_cols);//copy shared lines between blocks (up+lower lines)
 
-	RESET(copyDown[Id]);	
-	//SYNC(compute[Id]);
-	//EXIT_TP();
-
-	uint64_t *ts = FRAME(tSteps);
-	uint32_t n_tp = FRAME(nTp);
-	uint64_t * n_tpsync = FRAME(nTpSync);
-
-//	std::cout <<"TP: "<<n_tp<<" ID: " << Id <<" copyDown finish! "<<std::endl;	
-
-	//SYNC(compute[Id]);
 	if(Id==(nRowsCut-1)){
-
-		n_tpsync[4*n_tp+3]=ts[Id];
-		if((n_tp==(g_nSU-1))||(n_tpsync[4*n_tp+3]==FRAME(timeStep))){
-			SYNC(compute[Id]);
-		}
-		SYNC(compute[Id]);
+		uint32_t n_tp = FRAME(nTp);
+		uint64_t * n_tpsync = FRAME(nTpSync);
+		n_tpsync[4*n_tp+2]=frame->getEpoch()+1;
 	}else{
-		SYNC(compute[Id]);
 		SYNC(compute[Id+1]);
 	}
+	SYNC(compute[Id]);
+	ARRIVE();
 	EXIT_TP();
 }
 
@@ -200,7 +172,6 @@ void Stencil2DRowLoop::fire(void)
 	uint64_t bm_final = ((Id ==(nRowsCut-1))? (bm%nRowsCut):0) + rows_ini;
 	uint64_t pos = Id*rows_ini * n_cols; 
 	
-
 	computeInner_stencil2d(bp+pos, initial,share,bm_final,bn,n_rows,n_cols);
 
 //-------------------------- this part is used for solving cache size limition------------------------------------------//
@@ -233,92 +204,19 @@ void Stencil2DRowLoop::fire(void)
 
 //	printf("Line CPU %d: %" PRIu64 " - %" PRIu64 "\n",(int)getID(),(BlockPosition+pos_final),BlockM_final);
     
-	RESET(compute[Id]);	
-
-	Stencil2DRowLoopPre *pre = FRAME(pre);
-
-	uint64_t *ts = FRAME(tSteps);
-	--(ts[Id]);
-
-	//finalize = true, finish this Id 
-	bool *finalize = FRAME(finalize);
-	if( finalize[Id] == true)
-		EXIT_TP();
-
-	uint32_t n_tp = FRAME(nTp);
-	uint64_t * n_tpsync = FRAME(nTpSync);
-
-	if(nRowsCut==1){
-//		SYNC(copyUp[Id]);
-//		SYNC(copyDown[Id]);
-		n_tpsync[4*n_tp]=ts[Id];
-		n_tpsync[4*n_tp+1]=ts[Id];
-		if(n_tp==0){
-			if(g_nSU==1){
-				SYNC(copyUp[Id]);
-				SYNC(copyDown[Id]);
-			}else{
-				SYNC(copyUp[Id]);
-				add(&FRAME(checkDown));
-				add(&FRAME(computeDown));
-			}
-		}else if(n_tp==(g_nSU-1)){
-			SYNC(copyDown[Id]);
-			add(&FRAME(checkUp));
-			add(&FRAME(computeUp));
-		}else{
-			add(&FRAME(checkUp));
-			add(&FRAME(checkDown));
-
-			add(&FRAME(computeUp));
-			add(&FRAME(computeDown));
-		}
-			
-	}else{
-		if(Id ==0){
-//			SYNC(copyUp[Id]);
-			SYNC(copyUp[Id+1]);
-			n_tpsync[4*n_tp]=ts[Id];
-			
-			if(n_tp==0){
-				SYNC(copyUp[Id]);
-			}else{
-				add(&FRAME(checkUp));
-				add(&FRAME(computeUp));
-			}
-		}else if(Id==(nRowsCut-1)){
-//			SYNC(copyDown[Id]);
-			SYNC(copyDown[Id-1]);
-			n_tpsync[4*n_tp+1]=ts[Id];
-			if(n_tp==(g_nSU-1)){
-				SYNC(copyDown[Id]);
-			}else{
-				add(&FRAME(checkDown));
-				add(&FRAME(computeDown));
-			}
-		}else {
-			SYNC(copyUp[Id+1]);
-			SYNC(copyDown[Id-1]);
-		}
-	}
-
-
-	add(&pre[Id]);
-	if(ts[Id]==0){
-		SYNC(sync);
-		finalize[Id]=true;
-		//std::cout <<"TP: "<<n_tp<<" finish ID: " << Id <<std::endl;	
-	}
-//	std::cout <<"TP: " <<n_tp <<" compute: " << Id <<std::endl;	
-	
+	ARRIVE();
 	EXIT_TP();
 }
 
+//Every codelet of the time step arrived: publish it, then start the next one or finish
 void
-Stencil2DRowSync::fire(void)
+Stencil2DRowDecomposition::epochDone(void)
 {
-    LOAD_FRAME(Stencil2DRowDecomposition);
-	SIGNAL(signalUp);
-    EXIT_TP();
+	nTpSync[4*nTp]=getEpoch();
+	if(getEpoch()<timeStep){
+		nextEpoch();
+	}else{
+		signalUp->decDep();
+		retire();
+	}
 }
-
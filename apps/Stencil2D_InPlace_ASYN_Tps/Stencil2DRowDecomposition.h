@@ -5,6 +5,7 @@
 #include <stdlib.h>
 #include <darts.h>
 #include "SIMPLIFYING_DARTS.h"
+#include "Stencil2D_main.h"
 //#include "Stencil2D.h"
 //#include "Stencil2DKernel.h"
 //#include "Stencil2D_main.h"
@@ -12,11 +13,10 @@
 using namespace darts;
 
 
-DEF_CODELET_ITER(Stencil2DRowLoopCopyUp,2,SHORTWAIT);
-DEF_CODELET_ITER(Stencil2DRowLoopCopyDown,2,SHORTWAIT);
+DEF_CODELET_ITER(Stencil2DRowLoopCopyUp,1,SHORTWAIT);
+DEF_CODELET_ITER(Stencil2DRowLoopCopyDown,1,SHORTWAIT);
 DEF_CODELET_ITER(Stencil2DRowLoopPre,0,SHORTWAIT);
 DEF_CODELET_ITER(Stencil2DRowLoop,4,SHORTWAIT);
-DEF_CODELET(Stencil2DRowSync,2,LONGWAIT);
 DEF_CODELET(Stencil2DRowCheckUp,0,SHORTWAIT);
 DEF_CODELET(Stencil2DRowCheckDown,0,SHORTWAIT);
 DEF_CODELET(Stencil2DRowComputeUp,0,SHORTWAIT);
@@ -25,18 +25,21 @@ DEF_CODELET(Stencil2DRowComputeDown,0,SHORTWAIT);
 /*
 *in Stencil2DRowDecomposition TP:
 *
-*Stencil2DRowLoop has 4 dependences:up0,down0,up1,down1
-*	up0,down0: the uppest and lowest line of sub-array(inner of subarray)
-*	up1,down1: the upper and lower line of sub-array(out side of subarray)
-*	4 dependences means: the computation can't be execute until copy(up0,down0,up1,down1) finished. 
+*The TP is persistent, one epoch is one time step. Every codelet arrives once
+*per epoch and the epoch barrier re-arms them all for the next time step.
 *
-*checkUP,checkDown,ComputeUp,computeDown are related to these 4 dependences.
+*Stencil2DRowLoop[i] waits for the copies of its own shared lines (copyUp[i],
+*copyDown[i]) and for the copies its neighbours make of its border lines
+*(copyUp[i+1],copyDown[i-1]), so it does not overwrite a line before it is copied.
 *
-*nTpSync[4]: up,down,Up finished,Down finish
+*checkUP,checkDown,ComputeUp,computeDown do the same with the neighbour TPs,
+*they spin on nTpSync until the neighbour reached the right epoch.
+*
+*nTpSync[4*nTp]: epochs done, [4*nTp+1]: epochs copyUp[0] done, [4*nTp+2]: epochs copyDown[last] done
 *
 */
 
-DEF_TP(Stencil2DRowDecomposition)
+DEF_PERSISTENT_TP(Stencil2DRowDecomposition)
 {
 	double *initial; //matrix pointer initial matrix[M][N]
 	const uint64_t nRows; // matrix M row
@@ -49,16 +52,13 @@ DEF_TP(Stencil2DRowDecomposition)
 	Stencil2DRowLoopCopyDown *copyDown;//codelet copy shared Down line
 	Stencil2DRowLoopPre *pre;
 	Stencil2DRowLoop *compute;
-	Stencil2DRowSync  sync;
 	Stencil2DRowCheckUp checkUp;
 	Stencil2DRowCheckDown checkDown;
 	Stencil2DRowComputeUp computeUp;
 	Stencil2DRowComputeDown computeDown;
 	Codelet*   signalUp;
 	double * shareRows;//every nt has an inner matrix which is used to story original data 
-	uint64_t *tSteps;
 	uint32_t nRowsCut;
-	bool *finalize;
 
 	Stencil2DRowDecomposition(double *inimatrix,const uint64_t inim,const uint64_t inin,uint64_t ts,uint32_t tp,uint64_t *ntpsync, Codelet *up)
 	:initial(inimatrix)
@@ -79,31 +79,48 @@ DEF_TP(Stencil2DRowDecomposition)
 		pre			= new Stencil2DRowLoopPre[nRowsCut];
 		compute		= new Stencil2DRowLoop[nRowsCut];
 		shareRows	= new double[nRowsCut*2*inin];
-		tSteps		= new uint64_t[nRowsCut];
-		sync		= Stencil2DRowSync{nRowsCut,nRowsCut,this,LONGWAIT};
-		finalize	= new bool[nRowsCut];	 
-		add(&sync);
+		bool first	= (tp==0);
+		bool last	= (tp==(g_nSU-1));
         
 		for ( size_t i = 0; i < nRowsCut; ++i ) {
-				tSteps[i]=ts;
-				finalize[i]=false;
-				copyUp[i] = Stencil2DRowLoopCopyUp {1,2,this,SHORTWAIT,i};
-				copyDown[i] = Stencil2DRowLoopCopyDown {1,2,this,SHORTWAIT,i};
-
+				uint32_t nUp = 1 + ((i==0 && !first)?1:0);
+				uint32_t nDown = 1 + ((i==(nRowsCut-1) && !last)?1:0);
+				uint32_t deps = 2 + ((i>0)?1:0) + ((i<(nRowsCut-1))?1:0)
+				              + ((i==0 && !first)?1:0) + ((i==(nRowsCut-1) && !last)?1:0);
+				copyUp[i] = Stencil2DRowLoopCopyUp {nUp,nUp,this,SHORTWAIT,i};
+				copyDown[i] = Stencil2DRowLoopCopyDown {nDown,nDown,this,SHORTWAIT,i};
 				pre[i] = Stencil2DRowLoopPre {0,0,this,SHORTWAIT,i};
-           		compute[i] = Stencil2DRowLoop {4,4,this,SHORTWAIT,i};
-				add (pre + i);
+				compute[i] = Stencil2DRowLoop {deps,deps,this,SHORTWAIT,i};
+				addMember(pre + i, true);
+				addMember(copyUp + i);
+				addMember(copyDown + i);
+				addMember(compute + i);
+		}
+		if(!first){
+			addMember(&checkUp, true);
+			addMember(&computeUp, true);
+		}
+		if(!last){
+			addMember(&checkDown, true);
+			addMember(&computeDown, true);
+		}
+		if(timeStep)
+			begin();
+		else{
+			signalUp->decDep();
+			retire();
 		}
 	}
 	uint32_t computeRowDecomposition(const uint64_t n_rows,const uint64_t n_cols);
 
+	virtual void epochDone(void);
+
 	~Stencil2DRowDecomposition(){
 		delete []copyUp;
 		delete []copyDown;
 		delete []compute;
 		delete []shareRows;
 		delete []pre;
-		delete []tSteps;
 	}
 };
 
@@ -22,6 +22,7 @@
 #include <cerrno>
 #include <iostream>
 #include <algorithm>
+#include <cmath>
 #include "Stencil2D_main.h"
 #include "Stencil2DPartition.h"
 #include "Stencil2DKernel.h"
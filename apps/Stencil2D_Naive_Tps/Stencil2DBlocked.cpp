@@ -0,0 +1,34 @@
+
+#include "Stencil2D_main.h"
+#include "Stencil2DBlocked.h"
+#include "Stencil2DKernel.h"
+
+void Stencil2DTileCompute::fire(void){
+	LOAD_FRAME(Stencil2DTile);
+	const blockRange &range = FRAME(range);
+	const uint64_t n_cols = FRAME(nCols); // Matrix N column
+	uint64_t bp = range.begin(0)*n_cols + range.begin(1);//block position of the tile in the matrix
+
+	computeInner_stencil2d(bp,FRAME(Initial),FRAME(New),range.size(0),range.size(1),n_cols);
+
+	SIGNAL(toSignal);
+	EXIT_TP();
+}
+
+
+
+void Stencil2DBlockedSwap::fire(void){
+	LOAD_FRAME(Stencil2DBlocked);
+	uint64_t timestep = FRAME(timeStep);
+	double *src = FRAME(Initial); //matrix pointer initial Matrix[M][N]
+	const uint64_t InitialM = FRAME(nRows); // matrix M row
+	const uint64_t InitialN = FRAME(nCols); // Matrix N column
+	double *dst = FRAME(New);
+	timestep --;
+
+	if (timestep == 0)
+		SIGNAL(signalUP);
+	else
+		INVOKE(Stencil2DBlocked,src,InitialM,InitialN,dst,timestep,FRAME(signalUP));
+	EXIT_TP();
+}
@@ -0,0 +1,71 @@
+#ifndef DARTS_STENCIL2DBLOCKED_H
+#define DARTS_STENCIL2DBLOCKED_H
+
+
+#include "SIMPLIFYING_DARTS.h"
+#include "Stencil2D_main.h"
+#include <stdint.h>
+
+
+using namespace darts;
+
+/*
+ * Same time steps as Stencil2DPartition, but the inner matrix is one
+ * blockedFor of N_ROWS_BLOCK_SZ x N_COLS_BLOCK_SZ tiles: each cluster gets a
+ * box of the matrix and splits it in tiles itself, instead of every cluster
+ * taking a band of rows cut in one row band per worker.
+ */
+DEF_CODELET(Stencil2DTileCompute,0,SHORTWAIT);
+DEF_CODELET(Stencil2DBlockedSwap,1,LONGWAIT);
+
+struct Stencil2DTile : public blockLoop
+{
+	double *Initial; //matrix pointer initial matrix[M][N]
+	double *New; //matrix pointer New matrix[M][N]
+	const uint64_t nCols; // Matrix N column
+	Stencil2DTileCompute compute;
+
+	Stencil2DTile(const blockRange &range, Codelet *toSig, double *inimatrix, double *newmatrix, const uint64_t n)
+	:blockLoop(range,toSig)
+	,Initial(inimatrix)
+	,New(newmatrix)
+	,nCols(n)
+	,compute(0,0,this,SHORTWAIT)
+	{
+		add(&compute);
+	}
+};
+
+DEF_TP(Stencil2DBlocked){
+	double *Initial; //matrix pointer initial matrix[M][N]
+	const uint64_t nRows; // matrix M row
+	const uint64_t nCols; // Matrix N column
+	double *New; //matrix pointer New matrix[M][N]
+	uint64_t timeStep;
+	Stencil2DBlockedSwap swapMatrix;
+	blockedFor<Stencil2DTile> tiles;
+	Codelet *signalUP;
+	
+	Stencil2DBlocked( double *inimatrix,const uint64_t m,const uint64_t n,double *newmatrix,uint64_t ts, Codelet *up)
+	:Initial(inimatrix)
+	,nRows(m)
+	,nCols(n)
+	,New(newmatrix)
+	,timeStep(ts)
+	,swapMatrix(1,1,this,LONGWAIT)
+	,tiles(0,1,this,SHORTWAIT,&swapMatrix,
+	       blockRange(1,m-1,N_ROWS_BLOCK_SZ,1,n-1,N_COLS_BLOCK_SZ),
+	       inimatrix,newmatrix,n)
+	,signalUP(up)
+	{
+		add(&tiles);
+	}		
+
+
+};
+
+
+
+
+
+#endif
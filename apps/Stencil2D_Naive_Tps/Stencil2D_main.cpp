@@ -22,12 +22,15 @@
 #include <cerrno>
 #include <iostream>
 #include <algorithm>
+#include <cmath>
 #include "Stencil2D_main.h"
 //#include <mkl_cblas.h>
 #include "Stencil2DKernel.h"
+#include "Stencil2DBlocked.h"
 static inline void usage(const char *name) 
 {
 	std::cout << "USAGE: " << name << "<num vector elems, num>0>" << std::endl;
+	std::cout << "       n_rows n_cols timesteps repeats nCUsPerCluster nClusters [blocked]" << std::endl;
 	//std::cout << "please input number of row, number of column,timesteps,nCU and nSU "<<"\n"<<std::endl;
 	DARTS_EXIT();
 	exit(0);
@@ -87,7 +90,7 @@ void init2Darray ( double* a, const size_t n_rows, const size_t n_cols )
 
 int main(int argc, char *argv[])
 {
-	if (argc != 7)
+	if (argc != 7 && argc != 8)
 		usage(argv[0]);
 
 	uint64_t N_ROWS = strtoul(argv[1],NULL,0);
@@ -96,6 +99,7 @@ int main(int argc, char *argv[])
 	uint64_t N_REPES = strtoul(argv[4],NULL,0);
 	uint32_t nCUsPerCluster = strtoul(argv[5],NULL,0);
 	uint32_t nClusters= strtoul(argv[6],NULL,0);
+	bool blocked = (argc == 8) && strtoul(argv[7],NULL,0);//tile the matrix with a blockedFor instead of row bands
 	g_nCU = nCUsPerCluster;
 	g_nSU = nClusters;
 
@@ -121,7 +125,10 @@ int main(int argc, char *argv[])
 			StartTime_w +=getTime();//start time for whole procedure
 			Runtime rt(&affin);		
 			StartTime_k +=getTime();//start time for kernal procedure
-			rt.run(launch<Stencil2DPartition>(InitialMatrix,N_ROWS,N_COLS,NewMatrix,N_TSTEPS, &Runtime::finalSignal)); 
+			if (blocked)
+				rt.run(launch<Stencil2DBlocked>(InitialMatrix,N_ROWS,N_COLS,NewMatrix,N_TSTEPS, &Runtime::finalSignal)); 
+			else
+				rt.run(launch<Stencil2DPartition>(InitialMatrix,N_ROWS,N_COLS,NewMatrix,N_TSTEPS, &Runtime::finalSignal)); 
 			EndTime +=getTime();//end time
 		}
 		AvgTime_k = (EndTime-StartTime_k)/N_REPES;
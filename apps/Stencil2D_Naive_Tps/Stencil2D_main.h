@@ -35,5 +35,8 @@ extern uint32_t g_nSU;
 #define N_COLS_TILE_SZ TILE_SIZE
 #define N_ROWS_TILE_SZ TILE_SIZE
 #define TOTAL_TILE_SZ (N_ROWS_TILE_SZ * N_COLS_TILE_SZ)
+//Tiles of Stencil2DBlocked, kept wide so the inner loop still streams a row
+#define N_ROWS_BLOCK_SZ N_ROWS_TILE_SZ
+#define N_COLS_BLOCK_SZ 1024
 
 #endif // DARTS_MSORT_H
@@ -72,8 +72,10 @@ public:
 class loadSCD : public StreamingCodelet<int, int>
 {
 public:
+    int next; //kept across firings, the codelet returns when its Fifo is full
     loadSCD(uint32_t dep, uint32_t res, Codelet *consumerCod, ThreadedProcedure * myTP, uint32_t stat):
-    StreamingCodelet(dep, res, consumerCod, myTP, stat) { }
+    StreamingCodelet(dep, res, consumerCod, myTP, stat),
+    next(0) { }
 
     virtual void fire(void);
 }; //loadSCD (streaming)
@@ -82,9 +84,11 @@ class copySCD : public StreamingCodelet<int, int>
 {
 public:
     Codelet * toSignal;
+    int next; //kept across firings, the codelet returns when its Fifo is empty
     copySCD(uint32_t dep, uint32_t res, Codelet *consumerCod, ThreadedProcedure * myTP, uint32_t stat, Codelet * toSig):
     StreamingCodelet(dep, res, consumerCod, myTP, stat),
-    toSignal(toSig) { }
+    toSignal(toSig),
+    next(0) { }
 
     virtual void fire(void);
 }; //copySCD (streaming)
@@ -129,12 +133,18 @@ void loadSCD::fire(void)
     SoftFifo<int> * localFifo = dynamic_cast<SoftFifo<int> *>(this->getConsumer());
     //std::cout << "localFifo is " << localFifo << std::endl;
     int * arr = (dynamic_cast<aTP *>(myTP_))->x;
-    for (int i=0; i<ARRAY_LENGTH; i++) {
-        std::cout << "loadSCD iter" << i << std::endl;
-        arr[i] = i;
-        while(localFifo->push(arr[i]) != 0);
-        //localFifo->push(arr[i]);
+    while (next<ARRAY_LENGTH) {
+        std::cout << "loadSCD iter" << next << std::endl;
+        arr[next] = next;
+        if (localFifo->push(arr[next]) != 0) {
+            //full: wait for copySCD to make room instead of spinning
+            if (waitOutput())
+                return;
+            continue;
+        }
+        next++;
     }
+    disassocConsFifo();
     std::cout << "loadSCD done firing" << std::endl;
 }
 
@@ -144,11 +154,17 @@ void copySCD::fire(void)
     //MsgQFifo<int> * localFifo = dynamic_cast<MsgQFifo<int> *>(this->getProducer());
     SoftFifo<int> * localFifo = dynamic_cast<SoftFifo<int> *>(this->getProducer());
     int * arr2 = (dynamic_cast<aTP *>(myTP_))->y;
-    for (int i=0; i<ARRAY_LENGTH; i++) {
-        std::cout << "copySCD iter" << i << std::endl;
-        while(localFifo->pop(&(arr2[i])) != 0);
-        //localFifo->pop(&(arr2[i]));
+    while (next<ARRAY_LENGTH) {
+        if (localFifo->pop(&(arr2[next])) != 0) {
+            //empty: wait for loadSCD to push more instead of spinning
+            if (waitInput())
+                return;
+            continue;
+        }
+        std::cout << "copySCD iter" << next << std::endl;
+        next++;
     }
+    disassocProdFifo();
     toSignal->decDep();
     std::cout << "copySCD done firing" << std::endl;
 }
@@ -186,6 +202,7 @@ int main(int argc, char *argv[])
             innerTime = 0;
         }
         std::cout << outerTime/OUTER << std::endl;
+        rt->printFifoStats();
         delete rt;
     }
     return 0;
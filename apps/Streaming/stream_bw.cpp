@@ -0,0 +1,261 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <sched.h>
+#include "darts.h"
+#include "StreamingCodelet.h"
+
+#define INNER 10
+#define OUTER 10
+
+using namespace darts;
+
+//Streams n ints from a producer to a consumer codelet and reports MB/s.
+//mode 0 moves one element per push/pop, mode 1 uses pushN/popN with
+//batch elements, mode 2 writes and reads batch elements in place through spans.
+//With "park" a blocked side parks on the Fifo and returns instead of
+//spinning, so both codelets can share a single worker.
+
+class endCD : public Codelet
+{
+public:
+    Codelet * toSignal;
+    endCD(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat, Codelet * toSig):
+    Codelet(dep, res, myTP, stat),
+    toSignal(toSig) { }
+
+    virtual void fire(void)
+    {
+        toSignal->decDep();
+    }
+};
+
+class produceSCD : public StreamingCodelet<int, int>
+{
+public:
+    int next;
+    int * local;
+    produceSCD(uint32_t dep, uint32_t res, Codelet *consumerCod, ThreadedProcedure * myTP, uint32_t stat, int batch):
+    StreamingCodelet(dep, res, consumerCod, myTP, stat),
+    next(0),
+    local(new int[batch]) { }
+    
+    ~produceSCD(void)
+    {
+        delete [] local;
+    }
+
+    virtual void fire(void);
+};
+
+class consumeSCD : public StreamingCodelet<int, int>
+{
+public:
+    Codelet * toSignal;
+    int next;
+    unsigned int sum;
+    int * local;
+    consumeSCD(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat, Codelet * toSig, int batch):
+    StreamingCodelet(dep, res, nullptr, myTP, stat),
+    toSignal(toSig),
+    next(0),
+    sum(0),
+    local(new int[batch]) { }
+    
+    ~consumeSCD(void)
+    {
+        delete [] local;
+    }
+
+    virtual void fire(void);
+};
+
+class streamTP : public ThreadedProcedure
+{
+public:
+    int n;
+    int mode;
+    int batch;
+    bool park;
+    unsigned int * sum;
+    produceSCD produce;
+    consumeSCD consume;
+    endCD endcd;
+    streamTP(int theN, int theMode, int theBatch, bool thePark, unsigned int * theSum, Codelet * toSig):
+    ThreadedProcedure(),
+    n(theN),
+    mode(theMode),
+    batch(theBatch),
+    park(thePark),
+    sum(theSum),
+    produce(0, 0, &consume, this, 0, theBatch),
+    consume(1, 1, this, 0, &endcd, theBatch),
+    endcd(1, 1, this, 0, toSig)
+    {
+        add(&produce);
+        add(&consume);
+        add(&endcd);
+    }
+};
+
+void produceSCD::fire(void)
+{
+    streamTP * myTP = static_cast<streamTP*>(myTP_);
+    SoftFifo<int> * fifo = static_cast<SoftFifo<int> *>(getConsumer());
+    int n = myTP->n;
+    int batch = myTP->batch;
+    while (next < n)
+    {
+        uint64_t done = 0;
+        if (myTP->mode == 0)
+        {
+            done = (fifo->push(next) == 0);
+        }
+        else if (myTP->mode == 1)
+        {
+            int count = (n - next < batch) ? n - next : batch;
+            for (int j = 0; j < count; j++)
+                local[j] = next + j;
+            done = fifo->pushN(local, count);
+        }
+        else
+        {
+            int * span;
+            done = fifo->acquireWriteSpan(span, (n - next < batch) ? n - next : batch);
+            for (uint64_t j = 0; j < done; j++)
+                span[j] = next + j;
+            fifo->commit(done);
+        }
+        next += done;
+        if (!done)
+        {
+            if (!myTP->park)
+                sched_yield(); //Let the consumer run when workers outnumber cores
+            else if (waitOutput())
+                return;
+        }
+    }
+    disassocConsFifo();
+}
+
+void consumeSCD::fire(void)
+{
+    streamTP * myTP = static_cast<streamTP*>(myTP_);
+    SoftFifo<int> * fifo = static_cast<SoftFifo<int> *>(getProducer());
+    int n = myTP->n;
+    int batch = myTP->batch;
+    while (next < n)
+    {
+        uint64_t done = 0;
+        if (myTP->mode == 0)
+        {
+            done = (fifo->pop(local) == 0);
+            if (done)
+                sum += local[0];
+        }
+        else if (myTP->mode == 1)
+        {
+            done = fifo->popN(local, batch);
+            for (uint64_t j = 0; j < done; j++)
+                sum += local[j];
+        }
+        else
+        {
+            const int * span;
+            done = fifo->acquireReadSpan(span, batch);
+            for (uint64_t j = 0; j < done; j++)
+                sum += span[j];
+            fifo->consume(done);
+        }
+        next += done;
+        if (!done)
+        {
+            if (!myTP->park)
+                sched_yield();
+            else if (waitInput())
+                return;
+        }
+    }
+    disassocProdFifo();
+    *(myTP->sum) = sum;
+    toSignal->decDep();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 6 && argc != 7)
+    {
+        std::cout << "enter number of TP CD elements mode(0 single, 1 pushN, 2 span) batch [park]" << std::endl;
+        return 0;
+    }
+
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    int n = atoi(argv[3]);
+    int mode = atoi(argv[4]);
+    int batch = atoi(argv[5]);
+    bool park = (argc == 7 && std::string(argv[6]) == "park");
+    if (n < 1 || batch < 1)
+        return 0;
+    unsigned int expected = 0;
+    for (int i = 0; i < n; i++)
+        expected += i;
+    
+    uint64_t innerTime = 0;
+    uint64_t outerTime = 0;
+    
+    ThreadAffinity affin(cds, tps, SPREAD, TPROUNDROBIN, MCSTANDARD);
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        unsigned int sum = 0;
+        for (int i = 0; i < OUTER; i++) 
+        {
+            rt->run(launch<streamTP>(n, mode, batch, park, &sum, &Runtime::finalSignal));
+            for (int j = 0; j < INNER; j++) 
+            {
+                uint64_t startTime = getTime();
+                rt->run(launch<streamTP>(n, mode, batch, park, &sum, &Runtime::finalSignal));
+                uint64_t endTime = getTime();
+                innerTime += endTime - startTime;
+                if (sum != expected)
+                    std::cout << "wrong sum " << sum << std::endl;
+            }
+            outerTime += innerTime / INNER;
+            innerTime = 0;
+        }
+        uint64_t avg = outerTime / OUTER;
+        std::cout << avg << " ns " << (double) n * sizeof(int) * 1000 / avg << " MB/s" << std::endl;
+        delete rt;
+    }
+    return 0;
+}
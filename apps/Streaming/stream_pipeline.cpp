@@ -0,0 +1,147 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <stdlib.h>
+#include <stdint.h>
+#include "darts.h"
+#include "Pipeline.h"
+
+#define RUNS 10
+#define SERVICES 16
+
+using namespace darts;
+
+//A log processing pipeline built with Pipeline: read -> parse -> enrich
+//(replicated) -> filter -> count. enrich costs about 10x parse, so it is
+//the stage that gets replicas. filter drops everything below WARN and the
+//sink counts the survivors per service.
+
+struct logRecord
+{
+    uint32_t seq;
+    uint32_t service;
+    uint32_t level;
+    uint32_t latency;
+    uint32_t hash;
+};
+
+//The per element work of a stage
+static uint32_t
+spin(uint32_t x, int work)
+{
+    for (int i = 0; i < work; i++)
+        x = x * 1103515245U + 12345U;
+    return x;
+}
+
+static void
+parse(logRecord & rec, int work)
+{
+    rec.hash = spin(rec.seq, work);
+    rec.service = rec.hash % SERVICES;
+    rec.level = (rec.hash >> 8) % 4;
+}
+
+static void
+enrich(logRecord & rec, int work)
+{
+    rec.latency = spin(rec.hash, 10 * work) % 1000;
+}
+
+static bool
+keep(const logRecord & rec)
+{
+    return rec.level >= 2 || rec.latency > 900;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 6)
+    {
+        std::cout << "enter number of TP CD records replicas work" << std::endl;
+        return 0;
+    }
+
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    uint32_t n = atoi(argv[3]);
+    int replicas = atoi(argv[4]);
+    int work = atoi(argv[5]);
+    if (n < 1 || replicas < 1)
+        return 0;
+    
+    uint64_t expected[SERVICES] = {0};
+    for (uint32_t i = 0; i < n; i++)
+    {
+        logRecord rec = {i, 0, 0, 0, 0};
+        parse(rec, work);
+        enrich(rec, work);
+        if (keep(rec))
+            expected[rec.service]++;
+    }
+    
+    uint32_t next = 0;
+    uint64_t counts[SERVICES];
+    Pipeline<logRecord> pipe;
+    pipe.source([&](logRecord & rec) -> bool {
+            if (next == n)
+                return false;
+            rec.seq = next++;
+            return true;
+        }, "read")
+        .stage([=](logRecord & rec) -> bool { parse(rec, work); return true; }, 1, "parse")
+        .stage([=](logRecord & rec) -> bool { enrich(rec, work); return true; }, replicas, "enrich")
+        .stage([](logRecord & rec) -> bool { return keep(rec); }, 1, "filter")
+        .sink([&](logRecord & rec) { counts[rec.service]++; }, "count");
+    
+    ThreadAffinity affin(cds, tps, SPREAD, TPROUNDROBIN, MCSTANDARD);
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        uint64_t total = 0;
+        for (int i = 0; i < RUNS; i++) 
+        {
+            next = 0;
+            for (int s = 0; s < SERVICES; s++)
+                counts[s] = 0;
+            pipe.run(rt);
+            total += pipe.getWallTime();
+            for (int s = 0; s < SERVICES; s++)
+            {
+                if (counts[s] != expected[s])
+                    std::cout << "wrong count for service " << s << ": " << counts[s] << " expected " << expected[s] << std::endl;
+            }
+        }
+        uint64_t avg = total / RUNS;
+        std::cout << avg << " ns " << (double) n * 1000 / avg << " Mrecords/s" << std::endl;
+        pipe.report();
+        rt->printFifoStats();
+        delete rt;
+    }
+    return 0;
+}
@@ -0,0 +1,293 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#include <iostream>
+#include <stdlib.h>
+#include "darts.h"
+#include "StreamingCodelet.h"
+
+#define INNER 10
+#define OUTER 10
+
+using namespace darts;
+
+//source -> replicas x work -> sink. The source deals n ints round robin to
+//the replicas through an SPMC Fifo, each replica spends work iterations per
+//element and pushes the result to the sink through an MPSC Fifo. All the
+//stages park on their Fifos instead of spinning. With one replica the two
+//edges are plain SPSC Fifos.
+
+class replicateTP;
+
+class endCD : public Codelet
+{
+public:
+    Codelet * toSignal;
+    endCD(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat, Codelet * toSig):
+    Codelet(dep, res, myTP, stat),
+    toSignal(toSig) { }
+
+    virtual void fire(void)
+    {
+        toSignal->decDep();
+    }
+};
+
+class sourceSCD : public StreamingCodelet<int, int>
+{
+public:
+    int next;
+    sourceSCD(uint32_t dep, uint32_t res, Codelet ** replicas, uint64_t numReplicas, ThreadedProcedure * myTP, uint32_t stat):
+    StreamingCodelet(dep, res, replicas, numReplicas, FANOUT_ROUNDROBIN, myTP, stat),
+    next(0) { }
+
+    virtual void fire(void);
+};
+
+class workSCD : public StreamingCodelet<int, int>
+{
+public:
+    int value;
+    bool pending;
+    workSCD(void):
+    StreamingCodelet(),
+    value(0),
+    pending(false) { }
+
+    virtual void fire(void);
+};
+
+class sinkSCD : public StreamingCodelet<int, int>
+{
+public:
+    Codelet * toSignal;
+    unsigned int sum;
+    sinkSCD(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat, Codelet * toSig):
+    StreamingCodelet(dep, res, nullptr, myTP, stat),
+    toSignal(toSig),
+    sum(0) { }
+
+    virtual void fire(void);
+};
+
+class replicateTP : public ThreadedProcedure
+{
+public:
+    int n;
+    int replicas;
+    int work;
+    unsigned int * result;
+    Codelet ** workers;
+    workSCD * stage;
+    sourceSCD source;
+    sinkSCD sink;
+    endCD endcd;
+    replicateTP(int theN, int theReplicas, int theWork, unsigned int * theResult, Codelet * toSig):
+    ThreadedProcedure(),
+    n(theN),
+    replicas(theReplicas),
+    work(theWork),
+    result(theResult),
+    workers(new Codelet*[theReplicas]),
+    stage(new workSCD[theReplicas]),
+    source(0, 0, workers, theReplicas, this, 0),
+    sink(1, 1, this, 0, &endcd),
+    endcd(1, 1, this, 0, toSig)
+    {
+        sink.setNumProducerCods(replicas);
+        for (int i = 0; i < replicas; i++)
+        {
+            workers[i] = &stage[i];
+            stage[i].initCodelet(1, 1, this, 0);
+            stage[i].setConsumerCod(&sink);
+            add(&stage[i]);
+        }
+        add(&source);
+        add(&sink);
+        add(&endcd);
+    }
+    
+    ~replicateTP(void)
+    {
+        delete [] stage;
+        delete [] workers;
+    }
+};
+
+//The per element work of the replicated stage
+static int
+spin(int x, int work)
+{
+    unsigned int u = x;
+    for (int i = 0; i < work; i++)
+        u = u * 1103515245U + 12345U;
+    return (int) u;
+}
+
+//The edges are SPSC with one replica, SPMC/MPSC otherwise
+static uint64_t
+pushOut(Fifo * fifo, bool shared, int value)
+{
+    if (shared)
+        return static_cast<MPSCFifo<int>*>(fifo)->push(value);
+    return static_cast<SoftFifo<int>*>(fifo)->push(value);
+}
+
+void sourceSCD::fire(void)
+{
+    replicateTP * myTP = static_cast<replicateTP*>(myTP_);
+    Fifo * fifo = getConsumer();
+    bool shared = (myTP->replicas > 1);
+    while (next < myTP->n)
+    {
+        uint64_t full = (shared) ? static_cast<SPMCFifo<int>*>(fifo)->push(next) : static_cast<SoftFifo<int>*>(fifo)->push(next);
+        if (full)
+        {
+            if (waitOutput())
+                return;
+            continue;
+        }
+        next++;
+    }
+    disassocConsFifo();
+}
+
+void workSCD::fire(void)
+{
+    replicateTP * myTP = static_cast<replicateTP*>(myTP_);
+    Fifo * in = getProducer();
+    bool shared = (myTP->replicas > 1);
+    while (true)
+    {
+        if (pending)
+        {
+            if (pushOut(getConsumer(), shared, value))
+            {
+                if (waitOutput())
+                    return;
+                continue;
+            }
+            pending = false;
+        }
+        //Everything pushed before the source closed is visible once we see it closed
+        bool closed = in->closed();
+        int x;
+        uint64_t empty = (shared) ? static_cast<SPMCFifo<int>*>(in)->pop(&x, inputLane()) : static_cast<SoftFifo<int>*>(in)->pop(&x);
+        if (!empty)
+        {
+            value = spin(x, myTP->work);
+            pending = true;
+            continue;
+        }
+        if (closed)
+            break;
+        if (waitInput())
+            return;
+    }
+    //Both sides let go of a Fifo so the TP scheduler can reuse it next run
+    disassocProdFifo();
+    disassocConsFifo();
+}
+
+void sinkSCD::fire(void)
+{
+    replicateTP * myTP = static_cast<replicateTP*>(myTP_);
+    Fifo * in = getProducer();
+    bool shared = (myTP->replicas > 1);
+    while (true)
+    {
+        bool closed = in->closed();
+        int x;
+        uint64_t empty = (shared) ? static_cast<MPSCFifo<int>*>(in)->pop(&x) : static_cast<SoftFifo<int>*>(in)->pop(&x);
+        if (!empty)
+        {
+            sum += x;
+            continue;
+        }
+        if (closed)
+            break;
+        if (waitInput())
+            return;
+    }
+    disassocProdFifo();
+    *(myTP->result) = sum;
+    toSignal->decDep();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 6)
+    {
+        std::cout << "enter number of TP CD elements replicas work" << std::endl;
+        return 0;
+    }
+
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    int n = atoi(argv[3]);
+    int replicas = atoi(argv[4]);
+    int work = atoi(argv[5]);
+    if (n < 1 || replicas < 1)
+        return 0;
+    
+    //The sum does not depend on which replica handled which element
+    unsigned int expected = 0;
+    for (int i = 0; i < n; i++)
+        expected += spin(i, work);
+    
+    uint64_t innerTime = 0;
+    uint64_t outerTime = 0;
+    
+    ThreadAffinity affin(cds, tps, SPREAD, TPROUNDROBIN, MCSTANDARD);
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        unsigned int result = 0;
+        for (int i = 0; i < OUTER; i++) 
+        {
+            rt->run(launch<replicateTP>(n, replicas, work, &result, &Runtime::finalSignal));
+            for (int j = 0; j < INNER; j++) 
+            {
+                uint64_t startTime = getTime();
+                rt->run(launch<replicateTP>(n, replicas, work, &result, &Runtime::finalSignal));
+                uint64_t endTime = getTime();
+                innerTime += endTime - startTime;
+                if (result != expected)
+                    std::cout << "wrong sum " << result << std::endl;
+            }
+            outerTime += innerTime / INNER;
+            innerTime = 0;
+        }
+        uint64_t avg = outerTime / OUTER;
+        std::cout << avg << " ns " << (double) n * 1000 / avg << " Melements/s" << std::endl;
+        rt->printFifoStats();
+        delete rt;
+    }
+    return 0;
+}
@@ -0,0 +1,196 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include "darts.h"
+
+#define INNER 100
+#define OUTER 10
+
+using namespace darts;
+
+/*
+ * Spawn cost of invoke. A root TP invokes Fanout children which take a
+ * std::vector payload by value. The legacy path rebuilds the old fixed
+ * arity closure locally: the argument is copied into invoke, copied into
+ * the closure and copied again into the constructor. The variadic path
+ * moves the payload all the way into the child.
+ */
+
+template< class arg1, class arg2 >
+struct legacyClosure2 : tpClosure
+{
+    arg1 a1;
+    arg2 a2;
+
+    legacyClosure2(tpfactory tpf, ThreadedProcedure * daddy, arg1 A1, arg2 A2) :
+    tpClosure(tpf, daddy),
+    a1(A1), a2(A2)
+    {
+    }
+};
+
+template<class newTP, class arg1, class arg2 >
+ThreadedProcedure *
+legacyFactory(tpClosure * closure) {
+    legacyClosure2< arg1, arg2 > * args = static_cast<legacyClosure2< arg1, arg2 >*> (closure);
+    myThread.tempParent = args->parent;
+    ThreadedProcedure * temp = new newTP(args->a1, args->a2);
+    if (temp->decRef()) {
+        delete temp;
+        return NULL;
+    }
+    myThread.tempParent = NULL;
+    return temp;
+}
+
+template<class newTP, class arg1, class arg2 >
+void
+legacyInvoke(ThreadedProcedure * parentTP, arg1 A1, arg2 A2) {
+    parentTP->incRef();
+    tpfactory funct = &legacyFactory<newTP, arg1, arg2 >;
+    tpClosure * closure = new legacyClosure2< arg1, arg2 > (funct, parentTP, A1, A2);
+    myThread.threadTPsched->pushTP(closure);
+}
+
+class childTP : public ThreadedProcedure
+{
+public:
+    std::vector<int> payload;
+    childTP(std::vector<int> data, Codelet * toSig):
+    ThreadedProcedure(),
+    payload(std::move(data))
+    {
+        toSig->decDep();
+    }
+};
+
+class spawnCD : public Codelet
+{
+public:
+    int fanout;
+    int size;
+    bool legacy;
+    Codelet * toSignal;
+    spawnCD(ThreadedProcedure * myTP, int fan, int sz, bool old, Codelet * toSig):
+    Codelet(0, 0, myTP, 0),
+    fanout(fan),
+    size(sz),
+    legacy(old),
+    toSignal(toSig) { }
+
+    virtual void fire(void)
+    {
+        for(int i = 0; i < fanout; i++)
+        {
+            std::vector<int> data(size, i);
+            if(legacy)
+                legacyInvoke<childTP>(myTP_, data, toSignal);
+            else
+                invoke<childTP>(myTP_, std::move(data), toSignal);
+        }
+    }
+};
+
+class syncCD : public Codelet
+{
+public:
+    Codelet * toSignal;
+    syncCD(uint32_t dep, ThreadedProcedure * myTP, Codelet * toSig):
+    Codelet(dep, dep, myTP, 0),
+    toSignal(toSig) { }
+
+    virtual void fire(void)
+    {
+        toSignal->decDep();
+    }
+};
+
+class rootTP : public ThreadedProcedure
+{
+public:
+    syncCD sync;
+    spawnCD spawn;
+    rootTP(int fanout, int size, bool legacy, Codelet * toSig):
+    ThreadedProcedure(),
+    sync(fanout, this, toSig),
+    spawn(this, fanout, size, legacy, &sync)
+    {
+        add(&spawn);
+    }
+};
+
+static uint64_t
+timeSpawn(Runtime * rt, int fanout, int size, bool legacy)
+{
+    uint64_t innerTime = 0;
+    uint64_t outerTime = 0;
+    for (int i = 0; i < OUTER; i++) 
+    {
+        rt->run(launch<rootTP>(fanout, size, legacy, &Runtime::finalSignal));
+        for (int j = 0; j < INNER; j++) 
+        {
+            uint64_t startTime = getTime();
+            rt->run(launch<rootTP>(fanout, size, legacy, &Runtime::finalSignal));
+            uint64_t endTime = getTime();
+            innerTime += endTime - startTime;
+        }
+        outerTime += innerTime / INNER;
+        innerTime = 0;
+    }
+    return outerTime / OUTER;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 5)
+    {
+        std::cout << "enter number of TPs CDs Fanout PayloadInts" << std::endl;
+        return 0;
+    }
+
+    int tps = atoi(argv[1]);
+    int cds = atoi(argv[2]);
+    int fanout = atoi(argv[3]);
+    int size = atoi(argv[4]);
+    
+    ThreadAffinity affin(cds, tps, SPREAD, TPDYNAMIC, MCDYNAMIC);
+    if (affin.generateMask())
+    {
+        Runtime * rt = new Runtime(&affin);
+        uint64_t legacyTime = timeSpawn(rt, fanout, size, true);
+        uint64_t variadicTime = timeSpawn(rt, fanout, size, false);
+        std::cout << "legacy " << legacyTime << " ns/run "
+                  << legacyTime / fanout << " ns/spawn" << std::endl;
+        std::cout << "variadic " << variadicTime << " ns/run "
+                  << variadicTime / fanout << " ns/spawn" << std::endl;
+        delete rt;
+    }
+    return 0;
+}
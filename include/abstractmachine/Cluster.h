@@ -48,11 +48,14 @@ namespace hwloc {
         /** \brief Number of units in this cluster */
         uint64_t      _nbUnits;
 
+        /** \brief Logical ID of the socket holding the cluster */
+        uint64_t      _socketId;
+
         /** \brief units held in the cluster */
         Unit *_units;
     public:
-        Cluster(uint64_t id=0, uint64_t memId=0, uint64_t nbUnits=0, Unit *units=0) 
-            : _id(id), _memId(memId), _nbUnits(nbUnits), _units(units)
+        Cluster(uint64_t id=0, uint64_t memId=0, uint64_t nbUnits=0, Unit *units=0, uint64_t socketId=0) 
+            : _id(id), _memId(memId), _nbUnits(nbUnits), _socketId(socketId), _units(units)
         {}
         ~Cluster() { }
 
@@ -62,6 +65,8 @@ namespace hwloc {
         uint64_t      getMemId()   const { return _memId;   }
         /** \brief Returns the number of available units in the cluster */
         uint64_t      getNbUnits() const { return _nbUnits; }
+        /** \brief Returns the ID of the socket holding the cluster */
+        uint64_t      getSocketId() const { return _socketId; }
         /** \brief Returns the array of units in the cluster */
         Unit *getUnits()   const { return _units;   }
     };
@@ -3,12 +3,21 @@
 #define DARTS_HWLOC_FIFO_H
 
 #include <vector>
+#include <map>
+#include <atomic>
+#include <iostream>
+#include <typeinfo>
+#include <typeindex>
 #include "Lock.h"
 #include "Codelet.h"
 #include "MsgQ.hpp"
 #include "ringbuffer.h"
 
+//Default capacity of the Fifos the TP schedulers allocate between streaming codelets
+#define STREAM_FIFO_SIZE 256
+
 namespace darts {
+    class FifoPool;
 	
 //FifoMeta class doesn't deal with actual data elements so
 //it doesn't need to be a template. This makes it easier
@@ -23,6 +32,9 @@ namespace darts {
 		 _typeSize;
 	Codelet * _producer,
 	        * _consumer;
+	// codelets pushing to (popping from) the Fifo, _producer and _consumer are the first ones
+	uint64_t _numProducers,
+		 _numConsumers;
 	FifoMeta() {}
 	FifoMeta(const uint64_t cluster,
 		 const uint64_t localMem,
@@ -33,7 +45,9 @@ namespace darts {
 		  _localMem(localMem),
 		  _id(id),
 		  _size(size),
-		  _typeSize(typeSize)
+		  _typeSize(typeSize),
+		  _numProducers(1),
+		  _numConsumers(1)
 		{}
 	FifoMeta(const uint64_t cluster,
 		 const uint64_t localMem,
@@ -41,14 +55,18 @@ namespace darts {
 		 const uint64_t size,
 		 const uint64_t typeSize,
 		 Codelet *producer,
-		 Codelet *consumer)
+		 Codelet *consumer,
+		 const uint64_t numProducers = 1,
+		 const uint64_t numConsumers = 1)
 		: _cluster(cluster),
 	          _localMem(localMem),	
 		  _id(id),
 		  _size(size),
 		  _typeSize(typeSize),
 		  _producer(producer),
-		  _consumer(consumer)
+		  _consumer(consumer),
+		  _numProducers(numProducers),
+		  _numConsumers(numConsumers)
 		{}
 	uint64_t getCluster() const { return _cluster; }
 	uint64_t getLocalMem() const { return _localMem; }
@@ -57,6 +75,8 @@ namespace darts {
 	uint64_t getTypeSize() const { return _typeSize; }
 	Codelet * getProducer() { return _producer; }
 	Codelet * getConsumer() { return _consumer; }
+	uint64_t getNumProducers() const { return _numProducers; }
+	uint64_t getNumConsumers() const { return _numConsumers; }
 	void disassocProd() { _producer = nullptr; }
 	void disassocCons() { _consumer = nullptr; }
     };
@@ -68,15 +88,104 @@ namespace darts {
     class Fifo {
     protected: //was private -- should this still be private?
         FifoMeta _meta;
+
+        /*
+         * Cooperative streaming. A streaming codelet that cannot go on (no
+         * data to pop, no room to push) parks itself in its lane of the
+         * Fifo and returns from fire. The other side reschedules it once it
+         * has pushed (or popped) _wakeStep elements past that point, or once
+         * all the producers are done. A side about to park first wakes up
+         * the other one, which has work since the Fifo is empty (or full).
+         * Codelets that spin on push/pop never park and pay only an index
+         * check every _wakeStep elements.
+         */
+        std::atomic<Codelet*> * _parkedCons;
+        std::atomic<Codelet*> * _parkedProd;
+        std::atomic<uint64_t> _openProds;
+        std::atomic<uint64_t> _attachedProds;
+        uint64_t _wakeStep;
+        // the pool the Fifo goes back to once every producer and consumer let go of it
+        FifoPool * _pool;
+        std::atomic<uint64_t> _holders;
+
+        void initLanes(void) {
+            _parkedCons = new std::atomic<Codelet*>[_meta._numConsumers];
+            _parkedProd = new std::atomic<Codelet*>[_meta._numProducers];
+            resetLanes();
+        }
+        void resetLanes(void) {
+            for (uint64_t i = 0; i < _meta._numConsumers; i++)
+                _parkedCons[i].store(nullptr, std::memory_order_relaxed);
+            for (uint64_t i = 0; i < _meta._numProducers; i++)
+                _parkedProd[i].store(nullptr, std::memory_order_relaxed);
+            _openProds.store(_meta._numProducers);
+            _attachedProds.store(0);
+            _holders.store(_meta._numProducers + _meta._numConsumers);
+        }
+
+        // one producer or consumer is done with the Fifo, the last one hands it back to its pool
+        void release(void);
+        // drops the elements left in a Fifo that is being recycled,
+        // kept apart from clear(), which MsgQFifo declares with another signature
+        virtual void recycleStorage(void) { }
+
+        //Reschedules the codelet parked in lane, if any
+        void wake(std::atomic<Codelet*> & lane) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (lane.load(std::memory_order_relaxed)) {
+                Codelet * cod = lane.exchange(nullptr);
+                if (cod)
+                    cod->reschedule();
+            }
+        }
+        void wakeAll(std::atomic<Codelet*> * lanes, uint64_t num) {
+            for (uint64_t i = 0; i < num; i++)
+                wake(lanes[i]);
+        }
+        void wakeConsumers(void) { wakeAll(_parkedCons, _meta._numConsumers); }
+        void wakeProducers(void) { wakeAll(_parkedProd, _meta._numProducers); }
+
+        //True when going from count - n to count elements crossed a watermark
+        bool crossed(uint64_t count, uint64_t n) const {
+            return(((count - n) ^ count) & ~(_wakeStep - 1));
+        }
+
+        //Parks cod unless the Fifo became ready meanwhile, true when cod must return from fire
+        bool park(bool consumer, uint64_t lane, Codelet * cod) {
+            std::atomic<Codelet*> & slot = (consumer) ? _parkedCons[lane] : _parkedProd[lane];
+            if (consumer)
+                wakeProducers();
+            else
+                wakeConsumers();
+            slot.store(cod);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!readyAfterPark(consumer, lane))
+                return(true);
+            //Undo unless the other side already rescheduled us
+            return(slot.exchange(nullptr) == nullptr);
+        }
+
+        //Re-checked by park once the codelet is visible to the other side
+        virtual bool readyAfterPark(bool, uint64_t) { return(true); }
+
     public:
-        Fifo() {}
+        Fifo():
+        _wakeStep(1),
+        _pool(nullptr) { 
+	    _meta._numProducers = 1;
+	    _meta._numConsumers = 1;
+	    initLanes();
+	}
         Fifo(const uint64_t cluster,
              const uint64_t localMem,
              const uint64_t id,
 	     uint64_t size,
-	     uint64_t typeSize) 
+	     uint64_t typeSize):
+        _wakeStep(1),
+        _pool(nullptr)
         {
 	    _meta = FifoMeta(cluster, localMem, id, size, typeSize);
+	    initLanes();
 	}
         Fifo(const uint64_t cluster,
              const uint64_t localMem,
@@ -84,11 +193,19 @@ namespace darts {
              uint64_t size,
 	     uint64_t typeSize,
              Codelet *producer,
-             Codelet *consumer) 
+             Codelet *consumer,
+             uint64_t numProducers = 1,
+             uint64_t numConsumers = 1):
+        _wakeStep(1),
+        _pool(nullptr)
         {
-	    _meta = FifoMeta(cluster, localMem, id, size, typeSize, producer, consumer);
+	    _meta = FifoMeta(cluster, localMem, id, size, typeSize, producer, consumer, numProducers, numConsumers);
+	    initLanes();
+	}
+	virtual ~Fifo() { //makes Fifo polymorphic for dynamic_cast
+	    delete [] _parkedCons;
+	    delete [] _parkedProd;
 	}
-	virtual ~Fifo() { } //makes Fifo polymorphic for dynamic_cast
 
         /** \brief @return the cluster ID */
         uint64_t getCluster()  const { return _meta.getCluster();  }
@@ -100,12 +217,65 @@ namespace darts {
         uint64_t getSize()     const { return _meta.getSize();     }
 	uint64_t getTypeSize() const { return _meta.getTypeSize(); }
 	FifoMeta * getFifoMeta() const { return (FifoMeta *) &(_meta); }
-        //uint64_t getNumConsumers() const { return _meta.; }
-	//num consumers can be added later
+        uint64_t getNumProducers() const { return _meta.getNumProducers(); }
+        uint64_t getNumConsumers() const { return _meta.getNumConsumers(); }
         Codelet * getProducer()   { return _meta.getProducer(); }
-        Codelet * getConsumer()   { return _meta.getConsumer(); } //will have to be extended if multiple consumers allowed
-	void disassocProd() { this->_meta.disassocProd(); }
-	void disassocCons() { this->_meta.disassocCons(); }
+        Codelet * getConsumer()   { return _meta.getConsumer(); }
+	// one of the producers is done, once all of them are a parked consumer is woken up to drain the Fifo
+	void disassocProd() { 
+	    if (_openProds.fetch_sub(1) == 1) {
+	        this->_meta.disassocProd();
+	        wakeConsumers();
+	    }
+	    release();
+	}
+	// one of the consumers is done; neither side may touch the Fifo after its disassoc
+	void disassocCons() {
+	    this->_meta.disassocCons();
+	    release();
+	}
+	// a producer starts pushing to the Fifo, returns its lane
+	uint64_t attachProducer() { return(_attachedProds.fetch_add(1) % _meta._numProducers); }
+	// true once every producer called disassocProd
+	bool closed() const { return(_openProds.load() == 0); }
+
+	// elements pushed (popped) before a parked consumer (producer) is woken up, rounded down to a power of two
+	void setWatermark(uint64_t step) {
+	    uint64_t pow = 1;
+	    while (pow * 2 <= step && pow * 2 <= getSize())
+	        pow *= 2;
+	    _wakeStep = pow;
+	}
+	uint64_t getWatermark() const { return(_wakeStep); }
+
+	// memory held by the Fifo's buffers
+	virtual uint64_t bytes() const { return(getSize() * getTypeSize()); }
+	FifoPool * getPool() const { return(_pool); }
+	void setPool(FifoPool * pool) { _pool = pool; }
+
+	/* A pooled Fifo starts over, empty, between new codelets. Its type,
+	 * capacity and number of producers and consumers stay the same. Not
+	 * thread safe: only call it on a Fifo nobody else holds.
+	 */
+	void recycle(const uint64_t cluster, const uint64_t localMem, const uint64_t id, Codelet *producer, Codelet *consumer) {
+	    _meta._cluster = cluster;
+	    _meta._localMem = localMem;
+	    _meta._id = id;
+	    _meta._producer = producer;
+	    _meta._consumer = consumer;
+	    resetLanes();
+	    recycleStorage();
+	    setWatermark(getSize() / 4);
+	}
+
+	/* Called by a streaming consumer that found its lane of the Fifo empty
+	 * or a producer that found it full. Returns true when the codelet has
+	 * been parked, in which case it must return from fire right away
+	 * without touching its state: the other side may already have
+	 * rescheduled it. Returns false when it should try again.
+	 */
+	bool parkConsumer(Codelet * cod, uint64_t lane = 0) { return(park(true, lane, cod)); }
+	bool parkProducer(Codelet * cod, uint64_t lane = 0) { return(park(false, lane, cod)); }
 
 	/* Fifo class can't be a template because Codelets can't return them
 	 * without specifying type. Because Fifo can't be a template, these functions
@@ -119,15 +289,200 @@ namespace darts {
         
     };
 
-    // Lockless software Fifo implementation using deque from threadsafe
+    /*
+     * Counters of a FifoPool. Live Fifos are wired to codelets, pooled ones
+     * wait to be reused; the bytes are what their buffers hold.
+     */
+    struct fifoPoolStats
+    {
+        uint64_t allocs;
+        uint64_t reuses;
+        uint64_t releases;
+        uint64_t live;
+        uint64_t pooled;
+        uint64_t liveBytes;
+        uint64_t pooledBytes;
+
+        fifoPoolStats(void):
+        allocs(0), reuses(0), releases(0), live(0), pooled(0),
+        liveBytes(0), pooledBytes(0) { }
+
+        void add(const fifoPoolStats & other)
+        {
+            allocs += other.allocs;
+            reuses += other.reuses;
+            releases += other.releases;
+            live += other.live;
+            pooled += other.pooled;
+            liveBytes += other.liveBytes;
+            pooledBytes += other.pooledBytes;
+        }
+
+        void print(std::ostream &out = std::cout) const
+        {
+            out << "allocs: " << allocs
+                << " reuses: " << reuses
+                << " releases: " << releases
+                << " live: " << live
+                << " (" << liveBytes / 1024 << " KB)"
+                << " pooled: " << pooled
+                << " (" << pooledBytes / 1024 << " KB)" << std::endl;
+        }
+    };
+
+    /*
+     * Class: FifoPool
+     * The Fifos a TP scheduler wires between streaming codelets. A Fifo goes
+     * back to its pool once every producer called disassocProd and every
+     * consumer disassocCons, and the next edge asking for the same Fifo
+     * type, element size, capacity and number of producers and consumers
+     * gets it back, warm buffers included, instead of a new one. The pool
+     * owns every Fifo it adopted, in use or not, and clear deletes them, so
+     * Fifos whose codelets never let go are only freed there.
+     */
+    class FifoPool {
+        private:
+            struct key {
+                std::type_index type;
+                uint64_t typeSize;
+                uint64_t capacity;
+                uint64_t numProducers;
+                uint64_t numConsumers;
+
+                bool operator<(const key & other) const {
+                    if (type != other.type)
+                        return(type < other.type);
+                    if (typeSize != other.typeSize)
+                        return(typeSize < other.typeSize);
+                    if (capacity != other.capacity)
+                        return(capacity < other.capacity);
+                    if (numProducers != other.numProducers)
+                        return(numProducers < other.numProducers);
+                    return(numConsumers < other.numConsumers);
+                }
+            };
+
+            Lock _lock;
+            std::vector<Fifo*> _owned;
+            std::map<key, std::vector<Fifo*> > _free;
+            fifoPoolStats _stats;
+
+            FifoPool(const FifoPool &);
+            FifoPool & operator=(const FifoPool &);
+
+            // the rings round their capacity up to a power of two
+            static uint64_t capacityFor(uint64_t size) {
+                uint64_t cap = 1;
+                while (cap < size)
+                    cap <<= 1;
+                return(cap);
+            }
+
+        public:
+            FifoPool() { }
+            ~FifoPool() { clear(); }
+
+            /* A pooled Fifo of the given type (the most derived Fifo class)
+             * or nullptr when there is none; the caller recycles it.
+             */
+            Fifo * reuse(const std::type_info & type, uint64_t typeSize, uint64_t size, uint64_t numProducers, uint64_t numConsumers) {
+                key wanted = {std::type_index(type), typeSize, capacityFor(size), numProducers, numConsumers};
+                Fifo * fifo = nullptr;
+                _lock.lock();
+                std::map<key, std::vector<Fifo*> >::iterator it = _free.find(wanted);
+                if (it != _free.end() && !it->second.empty()) {
+                    fifo = it->second.back();
+                    it->second.pop_back();
+                    uint64_t held = fifo->bytes();
+                    _stats.reuses++;
+                    _stats.pooled--;
+                    _stats.pooledBytes -= held;
+                    _stats.live++;
+                    _stats.liveBytes += held;
+                }
+                _lock.unlock();
+                return(fifo);
+            }
+
+            // takes ownership of a Fifo built for the pool
+            void adopt(Fifo * fifo) {
+                fifo->setPool(this);
+                _lock.lock();
+                _owned.push_back(fifo);
+                _stats.allocs++;
+                _stats.live++;
+                _stats.liveBytes += fifo->bytes();
+                _lock.unlock();
+            }
+
+            // a Fifo of the pool nobody holds anymore
+            void give(Fifo * fifo) {
+                key from = {std::type_index(typeid(*fifo)), fifo->getTypeSize(), fifo->getSize(), fifo->getNumProducers(), fifo->getNumConsumers()};
+                uint64_t held = fifo->bytes();
+                _lock.lock();
+                _free[from].push_back(fifo);
+                _stats.releases++;
+                _stats.live--;
+                _stats.liveBytes -= held;
+                _stats.pooled++;
+                _stats.pooledBytes += held;
+                _lock.unlock();
+            }
+
+            // deletes every Fifo of the pool, only once no codelet uses them
+            void clear() {
+                _lock.lock();
+                for (size_t i = 0; i < _owned.size(); i++)
+                    delete _owned[i];
+                _owned.clear();
+                _free.clear();
+                _stats.live = _stats.pooled = 0;
+                _stats.liveBytes = _stats.pooledBytes = 0;
+                _lock.unlock();
+            }
+
+            fifoPoolStats getStats() {
+                _lock.lock();
+                fifoPoolStats stats = _stats;
+                _lock.unlock();
+                return(stats);
+            }
+    };
+
+    inline void Fifo::release(void) {
+        if (_holders.fetch_sub(1) == 1 && _pool)
+            _pool->give(this);
+    }
+
+    // Lockless single producer, single consumer software Fifo on top of spscRing
     template <typename T>
     class SoftFifo: public Fifo {
         private:
-	        ringBuffRef<T> _queue;
+	        spscRing<T> _queue;
+
+            // n elements were just pushed (popped), wake the other side when a watermark was crossed
+            void pushed(uint64_t n) {
+                if (crossed(_queue.pushedCount(), n))
+                    wake(_parkedCons[0]);
+            }
+            void popped(uint64_t n) {
+                if (crossed(_queue.pulledCount(), n))
+                    wake(_parkedProd[0]);
+            }
+
+            bool readyAfterPark(bool consumer, uint64_t) {
+                if (consumer)
+                    return(!_queue.emptyNow() || closed());
+                return(!_queue.fullNow());
+            }
+
+            void recycleStorage() { _queue.reset(); }
+
         public:
             SoftFifo()
             {
             }
+            // size is rounded up to a power of two, getSize returns the real capacity
             SoftFifo(const uint64_t cluster,
              const uint64_t localMem,
              const uint64_t id,
@@ -137,30 +492,13 @@ namespace darts {
             : Fifo(cluster, localMem, id, size, sizeof(T), producer, consumer)
              {
 		        _queue.initBuff(size);
+		        _meta._size = _queue.capacity();
+		        setWatermark(_meta._size / 4);
              }
             
-            
 	    uint64_t push(T toPush) {
-            // full if only 1 element available to avoid full/empty flags
-            /*
-            if ((_head == 0 && (_tail == (_meta.size - 1))) || (_tail == _head - 1)) {
-                return(-1);
-            }
-            else {
-                _queue[_tail] = toPush;
-                _tail = (_tail + 1) % _meta.size; //modulus for ring buffer wrap around
-            }
-		    else { 
-		        _tail++; 
-		    }
-		    if ((_tail == _head - 1) || ((_tail == (_meta._size - 1)) && (_head == 0))) {
-			    // if new _tail 1 behind _head, its full (has to leave empty slot)
-			    // also if _tail is last element and _head is 0 (wraparound)
-			    _full = true;
-
-		    }
-            */
             if (_queue.push(toPush)) {
+                pushed(1);
                 return(0);
             }
             else return(-1);
@@ -168,31 +506,251 @@ namespace darts {
 
 	    uint64_t pop(T *toPop) {
             if(_queue.pull(toPop)) {
+                popped(1);
                 return(0);
             }
             else return(-1);
         }
         
-            // can remove locks because not writing anything?
-            // gets head of queue but does not remove it / change flags
-            //template <typename T> int peek(T *toPeek) {
-        /*
-	    uint64_t peek(T *toPeek) {
-                return(0);
+            // pushes as many of the n elements as fit, returns how many were pushed
+	    uint64_t pushN(const T *toPush, uint64_t n) {
+            n = _queue.pushN(toPush, n);
+            pushed(n);
+            return(n);
+        }
+
+            // pops up to max elements, returns how many were popped
+	    uint64_t popN(T *toPop, uint64_t max) {
+            max = _queue.pullN(toPop, max);
+            popped(max);
+            return(max);
+        }
+
+            // zero copy push: write up to the returned count of slots at span, then commit them
+	    uint64_t acquireWriteSpan(T *&span, uint64_t want) {
+            return(_queue.acquireWriteSpan(span, want));
+        }
+
+	    void commit(uint64_t n) {
+            _queue.commit(n);
+            pushed(n);
+        }
+
+            // zero copy pop: read up to the returned count of slots at span, then consume them
+	    uint64_t acquireReadSpan(const T *&span, uint64_t want) {
+            return(_queue.acquireReadSpan(span, want));
+        }
+
+	    void consume(uint64_t n) {
+            _queue.consume(n);
+            popped(n);
+        }
+
+            // free slots seen by the producer, filled slots seen by the consumer
+	    uint64_t space() { return(_queue.space()); }
+	    uint64_t available() { return(_queue.available()); }
+	    bool empty() const { return(_queue.empty()); }
+
+	    uint64_t bytes() const { return(_queue.bytes()); }
+
+    };
+
+    /* Lockless Fifo shared by several producers (MP) and/or several
+     * consumers (MC): every consumer pops the next element, so a stage
+     * replicated behind it is load balanced. See MPSCFifo and MPMCFifo.
+     */
+    template <typename T, bool MP, bool MC>
+    class SharedFifo: public Fifo {
+        private:
+	        seqRing<T, MP, MC> _queue;
+
+            bool readyAfterPark(bool consumer, uint64_t) {
+                if (consumer)
+                    return(!_queue.emptyNow() || closed());
+                return(!_queue.fullNow());
             }
 
-            uint64_t clear() {
-                _lock.lock();
-                _empty = true;
-                _full = false;
-                _head = 0;
-                _tail = 0;
-		        _lock.unlock();
+            void recycleStorage() { _queue.reset(); }
+
+        public:
+            SharedFifo(const uint64_t cluster,
+             const uint64_t localMem,
+             const uint64_t id,
+             const uint64_t size,
+             Codelet *producer,
+             Codelet *consumer,
+             const uint64_t numProducers,
+             const uint64_t numConsumers)
+            : Fifo(cluster, localMem, id, size, sizeof(T), producer, consumer, numProducers, numConsumers)
+             {
+		        _queue.initBuff(size);
+		        _meta._size = _queue.capacity();
+		        setWatermark(_meta._size / 4);
+             }
+
+	    uint64_t push(T toPush) {
+            size_t ticket;
+            if (!_queue.push(toPush, ticket))
+                return(-1);
+            if (crossed(ticket, 1))
+                wakeConsumers();
+            return(0);
+        }
+
+	    uint64_t pop(T *toPop) {
+            size_t ticket;
+            if (!_queue.pull(toPop, ticket))
+                return(-1);
+            if (crossed(ticket, 1))
+                wakeProducers();
+            return(0);
+        }
+
+            // pushes as many of the n elements as fit, returns how many were pushed
+	    uint64_t pushN(const T *toPush, uint64_t n) {
+            uint64_t i = 0;
+            while (i < n && push(toPush[i]) == 0)
+                i++;
+            return(i);
+        }
+
+            // pops up to max elements, returns how many were popped
+	    uint64_t popN(T *toPop, uint64_t max) {
+            uint64_t i = 0;
+            while (i < max && pop(&toPop[i]) == 0)
+                i++;
+            return(i);
+        }
+
+	    bool empty() { return(_queue.emptyNow()); }
+
+	    uint64_t bytes() const { return(_queue.bytes()); }
+    };
+
+    template <typename T>
+    using MPSCFifo = SharedFifo<T, true, false>;
+    template <typename T>
+    using MPMCFifo = SharedFifo<T, true, true>;
+
+    // How a single producer Fifo with several consumers hands out the elements
+    enum FANOUT {FANOUT_ROUNDROBIN = 0,
+                 FANOUT_BROADCAST  = 1};
+
+    /* Single producer, several consumers, one spscRing lane per consumer.
+     * FANOUT_ROUNDROBIN deals the elements to the lanes in turn, skipping
+     * full lanes. FANOUT_BROADCAST gives every element to every lane and
+     * only pushes when all of them have room. Consumers pop from their own
+     * lane, which StreamingCodelet::inputLane returns.
+     */
+    template <typename T>
+    class SPMCFifo: public Fifo {
+        private:
+	        spscRing<T> * _lanes;
+	        uint64_t _next;
+	        FANOUT _mode;
+
+            bool readyAfterPark(bool consumer, uint64_t lane) {
+                if (consumer)
+                    return(!_lanes[lane].emptyNow() || closed());
+                if (_mode == FANOUT_BROADCAST) {
+                    for (uint64_t i = 0; i < _meta._numConsumers; i++)
+                        if (_lanes[i].fullNow())
+                            return(false);
+                    return(true);
+                }
+                for (uint64_t i = 0; i < _meta._numConsumers; i++)
+                    if (!_lanes[i].fullNow())
+                        return(true);
+                return(false);
+            }
+
+            void recycleStorage() {
+                for (uint64_t i = 0; i < _meta._numConsumers; i++)
+                    _lanes[i].reset();
+                _next = 0;
+            }
+
+        public:
+            SPMCFifo(const uint64_t cluster,
+             const uint64_t localMem,
+             const uint64_t id,
+             const uint64_t size,
+             Codelet *producer,
+             Codelet *consumer,
+             const uint64_t numConsumers,
+             FANOUT mode = FANOUT_ROUNDROBIN)
+            : Fifo(cluster, localMem, id, size, sizeof(T), producer, consumer, 1, numConsumers),
+              _next(0),
+              _mode(mode)
+             {
+		        _lanes = new spscRing<T>[numConsumers];
+		        for (uint64_t i = 0; i < numConsumers; i++)
+		            _lanes[i].initBuff(size);
+		        _meta._size = _lanes[0].capacity();
+		        setWatermark(_meta._size / 4);
+             }
+
+            virtual ~SPMCFifo() {
+                delete [] _lanes;
+            }
+
+            FANOUT getMode() const { return(_mode); }
+            // only between recycle and the first push
+            void setMode(FANOUT mode) { _mode = mode; }
+
+	    uint64_t push(T toPush) {
+            uint64_t num = _meta._numConsumers;
+            if (_mode == FANOUT_BROADCAST) {
+                for (uint64_t i = 0; i < num; i++)
+                    if (!_lanes[i].space())
+                        return(-1);
+                for (uint64_t i = 0; i < num; i++) {
+                    _lanes[i].push(toPush);
+                    if (crossed(_lanes[i].pushedCount(), 1))
+                        wake(_parkedCons[i]);
+                }
                 return(0);
             }
+            for (uint64_t tries = 0; tries < num; tries++) {
+                uint64_t i = _next;
+                _next = (_next + 1 == num) ? 0 : _next + 1;
+                if (_lanes[i].push(toPush)) {
+                    if (crossed(_lanes[i].pushedCount(), 1))
+                        wake(_parkedCons[i]);
+                    return(0);
+                }
+            }
+            return(-1);
         }
-            */
 
+            // pops from the consumer's own lane
+	    uint64_t pop(T *toPop, uint64_t lane) {
+            if (!_lanes[lane].pull(toPop))
+                return(-1);
+            if (crossed(_lanes[lane].pulledCount(), 1))
+                wake(_parkedProd[0]);
+            return(0);
+        }
+
+            // pushes as many of the n elements as fit, returns how many were pushed
+	    uint64_t pushN(const T *toPush, uint64_t n) {
+            uint64_t i = 0;
+            while (i < n && push(toPush[i]) == 0)
+                i++;
+            return(i);
+        }
+
+            // pops up to max elements from the consumer's lane, returns how many were popped
+	    uint64_t popN(T *toPop, uint64_t max, uint64_t lane) {
+            max = _lanes[lane].pullN(toPop, max);
+            if (crossed(_lanes[lane].pulledCount(), max))
+                wake(_parkedProd[0]);
+            return(max);
+        }
+
+	    bool empty(uint64_t lane) { return(_lanes[lane].emptyNow()); }
+
+	    uint64_t bytes() const { return(_lanes[0].bytes() * _meta._numConsumers); }
     };
 
 
@@ -164,6 +164,45 @@ public:
 
 				return returnValue;
 	}
+
+	/*
+			Function: loadAcquire
+
+			Reads a value published by another thread with one of the
+			atomics above or storeRelease, and what was written before it.
+	*/
+  template < class T > static T loadAcquire ( volatile T & source )
+	{
+
+		#ifdef __GNUC__
+
+			return __atomic_load_n( &source, __ATOMIC_ACQUIRE );
+
+		#elif _MSC_VER
+
+			return source;
+
+		#endif
+	}
+
+	/*
+			Function: storeRelease
+
+			Publishes a value and what was written before it to loadAcquire.
+	*/
+  template < class T > static void storeRelease ( volatile T & destination, T newval )
+	{
+
+		#ifdef __GNUC__
+
+			__atomic_store_n( &destination, newval, __ATOMIC_RELEASE );
+
+		#elif _MSC_VER
+
+			destination = newval;
+
+		#endif
+	}
         
 };
 
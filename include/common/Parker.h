@@ -0,0 +1,201 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PARKER_H
+#define	PARKER_H
+#include <stdint.h>
+#include <atomic>
+#include <iostream>
+#include "getClock.h"
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+#include <unistd.h>
+
+//Number of empty polls a worker does before parking
+#define PARK_SPINS 256
+//Upper bound on a park, only matters if a wake up gets lost
+#define PARK_TIMEOUT_NS 10000000
+
+namespace darts
+{
+    /*
+     * Struct: parkStats
+     * Parking counters of one or more workers. Latencies are in ns.
+     */
+    struct parkStats
+    {
+        uint64_t parks;
+        uint64_t wakes;
+        uint64_t timeouts;
+        uint64_t spurious;
+        uint64_t wakeLatency;
+        uint64_t maxWakeLatency;
+        uint64_t parkedTime;
+
+        parkStats(void):
+        parks(0), wakes(0), timeouts(0), spurious(0),
+        wakeLatency(0), maxWakeLatency(0), parkedTime(0) { }
+
+        void add(const parkStats & other)
+        {
+            parks += other.parks;
+            wakes += other.wakes;
+            timeouts += other.timeouts;
+            spurious += other.spurious;
+            wakeLatency += other.wakeLatency;
+            if(other.maxWakeLatency > maxWakeLatency)
+                maxWakeLatency = other.maxWakeLatency;
+            parkedTime += other.parkedTime;
+        }
+
+        void print(std::ostream &out = std::cout) const
+        {
+            out << "parks: " << parks
+                << " wakes: " << wakes
+                << " timeouts: " << timeouts
+                << " spurious: " << spurious
+                << " avg wake latency: " << ((wakes) ? wakeLatency / wakes : 0) << " ns"
+                << " max wake latency: " << maxWakeLatency << " ns"
+                << " parked time: " << parkedTime << " ns" << std::endl;
+        }
+    };
+
+    /*
+     * Class: Parker
+     * Eventcount used to block an idle worker on a futex. The worker calls
+     * prepare, checks its queues one last time and then calls either cancel
+     * or wait. Producers call notify after making work visible, which only
+     * costs a fence and a load when nobody is parked.
+     */
+    class Parker
+    {
+    private:
+        std::atomic<uint32_t> epoch_;
+        std::atomic<uint32_t> waiting_;
+        std::atomic<uint64_t> wakeStamp_;
+        //Only touched by the owner
+        parkStats stats_;
+
+        void futexWait(uint32_t epoch)
+        {
+#ifdef __linux__
+            timespec timeout;
+            timeout.tv_sec = 0;
+            timeout.tv_nsec = PARK_TIMEOUT_NS;
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch_), FUTEX_WAIT_PRIVATE, epoch, &timeout, NULL, 0);
+#else
+            if(epoch_.load(std::memory_order_acquire) == epoch)
+                usleep(PARK_TIMEOUT_NS / 1000);
+#endif
+        }
+
+        void futexWake(void)
+        {
+#ifdef __linux__
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch_), FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#endif
+        }
+
+    public:
+        Parker(void):
+        epoch_(0),
+        waiting_(0),
+        wakeStamp_(0) { }
+
+        //Announce the intent to park, the returned epoch is passed to wait
+        uint32_t prepare(void)
+        {
+            waiting_.store(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return epoch_.load(std::memory_order_acquire);
+        }
+
+        //Work showed up between prepare and wait
+        void cancel(void)
+        {
+            waiting_.store(0, std::memory_order_relaxed);
+        }
+
+        //Block until notified (or the timeout expires)
+        void wait(uint32_t epoch)
+        {
+            stats_.parks++;
+            uint64_t start = getTime();
+            futexWait(epoch);
+            waiting_.store(0, std::memory_order_relaxed);
+            uint64_t now = getTime();
+            stats_.parkedTime += now - start;
+            if(epoch_.load(std::memory_order_acquire) != epoch)
+            {
+                uint64_t stamp = wakeStamp_.load(std::memory_order_relaxed);
+                uint64_t latency = (now > stamp) ? now - stamp : 0;
+                stats_.wakes++;
+                stats_.wakeLatency += latency;
+                if(latency > stats_.maxWakeLatency)
+                    stats_.maxWakeLatency = latency;
+            }
+            else
+                stats_.timeouts++;
+        }
+
+        //Wakes the worker if it is parked, returns true if it was
+        bool notify(void)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(waiting_.load(std::memory_order_relaxed) && waiting_.exchange(0, std::memory_order_acq_rel))
+            {
+                wakeStamp_.store(getTime(), std::memory_order_relaxed);
+                epoch_.fetch_add(1, std::memory_order_release);
+                futexWake();
+                return true;
+            }
+            return false;
+        }
+
+        bool parked(void) const
+        {
+            return waiting_.load(std::memory_order_relaxed);
+        }
+
+        //The worker was woken up but did not find anything to do
+        void spurious(void)
+        {
+            stats_.spurious++;
+        }
+
+        const parkStats & getStats(void) const
+        {
+            return stats_;
+        }
+    };
+} //namespace darts
+
+#endif	/* PARKER_H */
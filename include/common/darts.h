@@ -36,5 +36,11 @@
 #include "loop.h"
 #include "Affinity.h"
 #include "nested.h"
+#include "blocked.h"
+#include "reduction.h"
+#include "coarsen.h"
+#include "taskGraph.h"
+#include "persistentTP.h"
+#include "slab.h"
 #endif	/* DARTS_H */
 
@@ -31,8 +31,11 @@
 #ifdef TBB
 #include <tbb/concurrent_queue.h>
 #else
-#include "thread_safe_vector.h"
+#include "thread_safe_deque.h"
 #endif
+#include <pthread.h>
+#include <atomic>
+#include "wsDeque.h"
 
 template <class T>
 class dartsPool
@@ -49,6 +52,12 @@ class dartsPool
 
         bool push(T input);
         
+        //Pushes n items, returns how many were pushed
+        size_t pushBatch(const T * input, size_t n);
+        
+        //Pops up to max items in pop order, returns how many were popped
+        size_t popBatch(T * output, size_t max);
+        
         bool pushHead(T input);
         
         bool pushTail(T input);
@@ -79,6 +88,23 @@ bool dartsPool<T>::push(T input)
     return true;
 }
 
+template <class T>
+size_t dartsPool<T>::pushBatch(const T * input, size_t n)
+{
+    for(size_t i = 0; i < n; i++)
+        pool.push(input[i]);
+    return n;
+}
+
+template <class T>
+size_t dartsPool<T>::popBatch(T * output, size_t max)
+{
+    size_t n = 0;
+    while(n < max && pool.try_pop(output[n]))
+        n++;
+    return n;
+}
+
 template <class T>
 bool dartsPool<T>::pushHead(T input)
 {
@@ -134,6 +160,19 @@ bool dartsPool<T>::push(T input)
     return true;
 }
 
+template <class T>
+size_t dartsPool<T>::pushBatch(const T * input, size_t n)
+{
+    pool.pushBackN(input, n);
+    return n;
+}
+
+template <class T>
+size_t dartsPool<T>::popBatch(T * output, size_t max)
+{
+    return pool.popBackN(output, max);
+}
+
 template <class T>
 bool dartsPool<T>::pushHead(T input)
 {
@@ -167,3 +206,177 @@ bool dartsPool<T>::empty(void)
 }
 
 #endif  
+
+/*
+ * Class: dartsStealPool
+ * Work-stealing flavor of dartsPool. The thread that claimed the pool pushes
+ * and pops the bottom of a lock-free Chase-Lev deque, other threads steal from
+ * the top. Pushes coming from any other thread go through a regular dartsPool
+ * inbox that the owner drains when its deque runs dry.
+ */
+template <class T>
+class dartsStealPool
+{
+    private:
+        darts::wsDeque<T> deque;
+        dartsPool<T> inbox;
+        std::atomic<size_t> inboxSize;
+        pthread_t owner;
+        volatile bool owned;
+        
+        bool isOwner(void) const
+        {
+            return owned && pthread_equal(owner, pthread_self());
+        }
+        
+        T popInbox(void)
+        {
+            if(!inboxSize.load(std::memory_order_relaxed))
+                return 0;
+            T temp = inbox.pop();
+            if(temp)
+                inboxSize.fetch_sub(1, std::memory_order_relaxed);
+            return temp;
+        }
+        
+    public:
+        dartsStealPool(void):
+        inboxSize(0),
+        owned(false) { }
+        
+        //Make the calling thread the owner of the deque
+        void claim(void);
+        
+        T pop(void);
+
+        bool push(T input);
+        
+        size_t pushBatch(const T * input, size_t n);
+        
+        size_t popBatch(T * output, size_t max);
+        
+        //Take from the end opposite of the owner
+        T steal(void);
+        
+        //Owner only: takes up to half of the victim's items (at most
+        //maxBatch), keeps all but one of them and returns that one
+        T stealHalf(dartsStealPool<T> & victim, size_t maxBatch);
+        
+        bool empty(void);
+        
+        size_t size(void);
+};
+
+template <class T>
+void dartsStealPool<T>::claim(void)
+{
+    owner = pthread_self();
+    owned = true;
+}
+
+template <class T>
+T dartsStealPool<T>::pop(void)
+{
+    if(!isOwner())
+        return steal();
+    T temp = deque.take();
+    if(!temp)
+        temp = popInbox();
+    return temp;
+}
+
+template <class T>
+bool dartsStealPool<T>::push(T input)
+{
+    if(isOwner())
+        deque.push(input);
+    else
+    {
+        inboxSize.fetch_add(1, std::memory_order_relaxed);
+        inbox.push(input);
+    }
+    return true;
+}
+
+template <class T>
+size_t dartsStealPool<T>::pushBatch(const T * input, size_t n)
+{
+    if(isOwner())
+        deque.pushBatch(input, n);
+    else
+    {
+        inboxSize.fetch_add(n, std::memory_order_relaxed);
+        inbox.pushBatch(input, n);
+    }
+    return n;
+}
+
+template <class T>
+size_t dartsStealPool<T>::popBatch(T * output, size_t max)
+{
+    size_t n = 0;
+    if(isOwner())
+    {
+        for(; n < max; n++)
+        {
+            if(!(output[n] = deque.take()))
+                break;
+        }
+    }
+    if(n < max && inboxSize.load(std::memory_order_relaxed))
+    {
+        size_t got = inbox.popBatch(output + n, max - n);
+        inboxSize.fetch_sub(got, std::memory_order_relaxed);
+        n += got;
+    }
+    //Thieves share the deque one item at a time
+    if(!isOwner())
+    {
+        for(; n < max; n++)
+        {
+            if(!(output[n] = deque.steal()))
+                break;
+        }
+    }
+    return n;
+}
+
+template <class T>
+T dartsStealPool<T>::steal(void)
+{
+    T temp = deque.steal();
+    if(!temp)
+        temp = popInbox();
+    return temp;
+}
+
+template <class T>
+T dartsStealPool<T>::stealHalf(dartsStealPool<T> & victim, size_t maxBatch)
+{
+    T first = victim.steal();
+    if(!first)
+        return 0;
+    size_t batch = victim.size() / 2;
+    if(batch > maxBatch)
+        batch = maxBatch;
+    for(; batch; batch--)
+    {
+        T temp = victim.steal();
+        if(!temp)
+            break;
+        push(temp);
+    }
+    return first;
+}
+
+template <class T>
+bool dartsStealPool<T>::empty(void)
+{
+    return deque.empty() && !inboxSize.load(std::memory_order_relaxed);
+}
+
+template <class T>
+size_t dartsStealPool<T>::size(void)
+{
+    return deque.size() + inboxSize.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,127 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include <stddef.h>
+#include <atomic>
+#include "dartsPool.h"
+
+//Every PRIO_AGE_PERIOD-th pop serves the lowest non empty level first
+#define PRIO_AGE_PERIOD 16
+
+/*
+ * Class: prioPool
+ * Multi-level pool, one FIFO dartsPool per priority level. pop takes from
+ * the highest non empty level, except every agePeriod-th pop which starts
+ * from the lowest one so bulk work cannot starve behind a steady stream
+ * of urgent work. Any thread may push or pop.
+ */
+template <class T, unsigned int levels>
+class prioPool
+{
+    private:
+        dartsPool<T> pools_[levels];
+        std::atomic<size_t> count_[levels];
+        std::atomic<unsigned int> ticks_;
+        unsigned int agePeriod_;
+        
+        T popLevel(unsigned int level)
+        {
+            if(!count_[level].load(std::memory_order_relaxed))
+                return 0;
+            T temp = pools_[level].popHead();
+            if(temp)
+                count_[level].fetch_sub(1, std::memory_order_relaxed);
+            return temp;
+        }
+        
+    public:
+        prioPool(void):
+        ticks_(0),
+        agePeriod_(PRIO_AGE_PERIOD)
+        {
+            for(unsigned int i = 0; i < levels; i++)
+                count_[i].store(0, std::memory_order_relaxed);
+        }
+        
+        //Levels past the last one are clamped to it
+        bool push(T input, unsigned int level)
+        {
+            if(level >= levels)
+                level = levels - 1;
+            count_[level].fetch_add(1, std::memory_order_relaxed);
+            return pools_[level].pushTail(input);
+        }
+        
+        T pop(void)
+        {
+            unsigned int tick = ticks_.fetch_add(1, std::memory_order_relaxed);
+            T temp = 0;
+            if(agePeriod_ && tick % agePeriod_ == agePeriod_ - 1)
+            {
+                for(unsigned int i = 0; i < levels && !temp; i++)
+                    temp = popLevel(i);
+            }
+            else
+            {
+                for(unsigned int i = levels; i && !temp; i--)
+                    temp = popLevel(i - 1);
+            }
+            return temp;
+        }
+        
+        //Highest non empty level, -1 when empty
+        int topLevel(void) const
+        {
+            for(unsigned int i = levels; i; i--)
+            {
+                if(count_[i - 1].load(std::memory_order_relaxed))
+                    return i - 1;
+            }
+            return -1;
+        }
+        
+        bool empty(void) const
+        {
+            return topLevel() < 0;
+        }
+        
+        size_t size(void) const
+        {
+            size_t total = 0;
+            for(unsigned int i = 0; i < levels; i++)
+                total += count_[i].load(std::memory_order_relaxed);
+            return total;
+        }
+        
+        //0 turns aging off
+        void setAgePeriod(unsigned int period)
+        {
+            agePeriod_ = period;
+        }
+};
@@ -29,6 +29,9 @@
 #ifndef RINGBUFFER_H
 #define	RINGBUFFER_H
 #include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+#include <atomic>
 #include "Atomics.h"
 #include "SyncSlot.h"
 
@@ -67,6 +70,37 @@ namespace darts
                 Atomics::fetchAdd(consumeCount, 1U);
                 return temp;
             }
+
+            //Single producer, pushes as many as fit and returns how many
+            size_t pushBatch(const T * toAdd, size_t n)
+            {
+                unsigned int space = num - (produceCount - consumeCount);
+                if(n > space)
+                    n = space;
+                for(size_t i = 0; i < n; i++)
+                    buffer_[(produceCount + i) & (num -1)] = toAdd[i];
+                if(n)
+                    Atomics::fetchAdd(produceCount, static_cast<unsigned int>(n));
+                return n;
+            }
+
+            //Single consumer, pulls up to max and returns how many
+            size_t pullBatch(T * toPull, size_t max)
+            {
+                unsigned int avail = produceCount - consumeCount;
+                if(max > avail)
+                    max = avail;
+                for(size_t i = 0; i < max; i++)
+                    toPull[i] = buffer_[(consumeCount + i) & (num -1)];
+                if(max)
+                    Atomics::fetchAdd(consumeCount, static_cast<unsigned int>(max));
+                return max;
+            }
+
+            bool empty() const
+            {
+                return produceCount == consumeCount;
+            }
     };
 
     template <typename T>
@@ -124,6 +158,400 @@ namespace darts
                 return true;
             }
     };
+
+    /*
+     * Class: spscRing
+     * Single producer, single consumer ring of T. The capacity is rounded up
+     * to a power of two. Each side keeps a copy of the other side's index
+     * and only reloads it when the ring looks full (or empty), and indices
+     * are published with release/acquire instead of a locked fetch-add.
+     * Besides push/pull one element at a time, pushN/pullN move arrays and
+     * the span calls hand out slots of the ring itself so the data can be
+     * written or read in place.
+     */
+    template <typename T>
+    class spscRing
+    {
+        private:
+            //Producer side
+            std::atomic<size_t> tail_;
+            size_t headCache_;
+            char pad1[64-sizeof(size_t)*2];
+            //Consumer side
+            std::atomic<size_t> head_;
+            size_t tailCache_;
+            char pad2[64-sizeof(size_t)*2];
+            T * buffer_;
+            size_t mask_;
+            
+            spscRing(const spscRing&);
+            spscRing& operator=(const spscRing&);
+            
+        public:
+            spscRing(void):
+            tail_(0),
+            headCache_(0),
+            head_(0),
+            tailCache_(0),
+            buffer_(NULL),
+            mask_(0) { }
+            
+            spscRing(size_t num):
+            tail_(0),
+            headCache_(0),
+            head_(0),
+            tailCache_(0),
+            buffer_(NULL),
+            mask_(0)
+            {
+                initBuff(num);
+            }
+            
+            ~spscRing(void)
+            {
+                free(buffer_);
+            }
+            
+            //Not thread safe, call before the ring is shared
+            void initBuff(size_t num)
+            {
+                size_t cap = 1;
+                while(cap < num)
+                    cap <<= 1;
+                free(buffer_);
+                buffer_ = (T *) malloc(sizeof(T) * cap);
+                mask_ = cap - 1;
+                tail_.store(0, std::memory_order_relaxed);
+                head_.store(0, std::memory_order_relaxed);
+                headCache_ = 0;
+                tailCache_ = 0;
+            }
+            
+            //Not thread safe, empties the ring and keeps its buffer
+            void reset(void)
+            {
+                tail_.store(0, std::memory_order_relaxed);
+                head_.store(0, std::memory_order_relaxed);
+                headCache_ = 0;
+                tailCache_ = 0;
+            }
+            
+            size_t capacity(void) const
+            {
+                return mask_ + 1;
+            }
+            
+            //Memory held by the buffer
+            size_t bytes(void) const
+            {
+                return sizeof(T) * capacity();
+            }
+            
+            //Producer, free slots from the producer's point of view. The
+            //cached head is refreshed when it shows fewer than want slots
+            size_t space(size_t want = 1)
+            {
+                size_t tail = tail_.load(std::memory_order_relaxed);
+                if(capacity() - (tail - headCache_) < want)
+                    headCache_ = head_.load(std::memory_order_acquire);
+                return capacity() - (tail - headCache_);
+            }
+            
+            //Consumer, filled slots from the consumer's point of view. The
+            //cached tail is refreshed when it shows fewer than want slots
+            size_t available(size_t want = 1)
+            {
+                size_t head = head_.load(std::memory_order_relaxed);
+                if(tailCache_ - head < want)
+                    tailCache_ = tail_.load(std::memory_order_acquire);
+                return tailCache_ - head;
+            }
+            
+            bool empty(void) const
+            {
+                return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire);
+            }
+            
+            //Consumer, like empty but refreshes the cached tail
+            bool emptyNow(void)
+            {
+                tailCache_ = tail_.load(std::memory_order_acquire);
+                return tailCache_ == head_.load(std::memory_order_relaxed);
+            }
+            
+            //Producer, true when no slot is free, refreshes the cached head
+            bool fullNow(void)
+            {
+                headCache_ = head_.load(std::memory_order_acquire);
+                return tail_.load(std::memory_order_relaxed) - headCache_ > mask_;
+            }
+            
+            //Elements pushed (pulled) since initBuff, only valid on the producer (consumer) side
+            size_t pushedCount(void) const
+            {
+                return tail_.load(std::memory_order_relaxed);
+            }
+            
+            size_t pulledCount(void) const
+            {
+                return head_.load(std::memory_order_relaxed);
+            }
+            
+            bool push(const T & toAdd)
+            {
+                size_t tail = tail_.load(std::memory_order_relaxed);
+                if(tail - headCache_ > mask_)
+                {
+                    headCache_ = head_.load(std::memory_order_acquire);
+                    if(tail - headCache_ > mask_)
+                        return false;
+                }
+                buffer_[tail & mask_] = toAdd;
+                tail_.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+            
+            bool pull(T * toPull)
+            {
+                size_t head = head_.load(std::memory_order_relaxed);
+                if(tailCache_ == head)
+                {
+                    tailCache_ = tail_.load(std::memory_order_acquire);
+                    if(tailCache_ == head)
+                        return false;
+                }
+                *toPull = buffer_[head & mask_];
+                head_.store(head + 1, std::memory_order_release);
+                return true;
+            }
+            
+            //Pushes as many as fit and returns how many, one publish for all
+            size_t pushN(const T * toAdd, size_t n)
+            {
+                size_t room = space(n);
+                if(n > room)
+                    n = room;
+                size_t tail = tail_.load(std::memory_order_relaxed);
+                for(size_t i = 0; i < n; i++)
+                    buffer_[(tail + i) & mask_] = toAdd[i];
+                if(n)
+                    tail_.store(tail + n, std::memory_order_release);
+                return n;
+            }
+            
+            //Pulls up to max and returns how many, one publish for all
+            size_t pullN(T * toPull, size_t max)
+            {
+                size_t avail = available(max);
+                if(max > avail)
+                    max = avail;
+                size_t head = head_.load(std::memory_order_relaxed);
+                for(size_t i = 0; i < max; i++)
+                    toPull[i] = buffer_[(head + i) & mask_];
+                if(max)
+                    head_.store(head + max, std::memory_order_release);
+                return max;
+            }
+            
+            /*
+             * Producer. Points span at up to want free slots that are
+             * contiguous in the ring and returns how many. Nothing is visible
+             * to the consumer until commit.
+             */
+            size_t acquireWriteSpan(T *& span, size_t want)
+            {
+                size_t room = space(want);
+                size_t tail = tail_.load(std::memory_order_relaxed);
+                size_t toEnd = capacity() - (tail & mask_);
+                if(want > room)
+                    want = room;
+                if(want > toEnd)
+                    want = toEnd;
+                span = &buffer_[tail & mask_];
+                return want;
+            }
+            
+            //Producer, publishes n slots written through acquireWriteSpan
+            void commit(size_t n)
+            {
+                tail_.store(tail_.load(std::memory_order_relaxed) + n, std::memory_order_release);
+            }
+            
+            //Consumer. Points span at up to want contiguous filled slots and returns how many
+            size_t acquireReadSpan(const T *& span, size_t want)
+            {
+                size_t avail = available(want);
+                size_t head = head_.load(std::memory_order_relaxed);
+                size_t toEnd = capacity() - (head & mask_);
+                if(want > avail)
+                    want = avail;
+                if(want > toEnd)
+                    want = toEnd;
+                span = &buffer_[head & mask_];
+                return want;
+            }
+            
+            //Consumer, gives back n slots read through acquireReadSpan
+            void consume(size_t n)
+            {
+                head_.store(head_.load(std::memory_order_relaxed) + n, std::memory_order_release);
+            }
+    };
+
+    /*
+     * Class: seqRing
+     * Bounded ring shared by several producers (multiProd) and/or several
+     * consumers (multiCons). Each slot carries a sequence number saying
+     * whether it is free for the ticket landing on it or holds that
+     * ticket's data, so slots can be filled and emptied out of order and
+     * only a shared index needs a CAS. The capacity is rounded up to a
+     * power of two. Tickets count from 1, the n-th element pushed has
+     * ticket n.
+     */
+    template <typename T, bool multiProd, bool multiCons>
+    class seqRing
+    {
+        private:
+            struct slot
+            {
+                std::atomic<size_t> seq;
+                T data;
+            };
+            std::atomic<size_t> tail_;
+            char pad1[64-sizeof(size_t)];
+            std::atomic<size_t> head_;
+            char pad2[64-sizeof(size_t)];
+            slot * buffer_;
+            size_t mask_;
+            
+            seqRing(const seqRing&);
+            seqRing& operator=(const seqRing&);
+            
+        public:
+            seqRing(void):
+            tail_(0),
+            head_(0),
+            buffer_(NULL),
+            mask_(0) { }
+            
+            ~seqRing(void)
+            {
+                delete [] buffer_;
+            }
+            
+            //Not thread safe, call before the ring is shared
+            void initBuff(size_t num)
+            {
+                size_t cap = 1;
+                while(cap < num)
+                    cap <<= 1;
+                delete [] buffer_;
+                buffer_ = new slot[cap];
+                for(size_t i = 0; i < cap; i++)
+                    buffer_[i].seq.store(i, std::memory_order_relaxed);
+                mask_ = cap - 1;
+                tail_.store(0, std::memory_order_relaxed);
+                head_.store(0, std::memory_order_relaxed);
+            }
+            
+            //Not thread safe, empties the ring and keeps its buffer
+            void reset(void)
+            {
+                for(size_t i = 0; i <= mask_; i++)
+                    buffer_[i].seq.store(i, std::memory_order_relaxed);
+                tail_.store(0, std::memory_order_relaxed);
+                head_.store(0, std::memory_order_relaxed);
+            }
+            
+            size_t capacity(void) const
+            {
+                return mask_ + 1;
+            }
+            
+            //Memory held by the buffer, sequence numbers included
+            size_t bytes(void) const
+            {
+                return sizeof(slot) * capacity();
+            }
+            
+            //Pushes toAdd and sets ticket, false when the ring is full
+            bool push(const T & toAdd, size_t & ticket)
+            {
+                size_t pos = tail_.load(std::memory_order_relaxed);
+                slot * cell;
+                for(;;)
+                {
+                    cell = &buffer_[pos & mask_];
+                    size_t seq = cell->seq.load(std::memory_order_acquire);
+                    intptr_t dif = (intptr_t) seq - (intptr_t) pos;
+                    if(dif == 0)
+                    {
+                        if(!multiProd)
+                        {
+                            tail_.store(pos + 1, std::memory_order_relaxed);
+                            break;
+                        }
+                        if(tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if(dif < 0)
+                        return false;
+                    else
+                        pos = tail_.load(std::memory_order_relaxed);
+                }
+                cell->data = toAdd;
+                cell->seq.store(pos + 1, std::memory_order_release);
+                ticket = pos + 1;
+                return true;
+            }
+            
+            //Pulls into toPull and sets ticket, false when the ring is empty
+            bool pull(T * toPull, size_t & ticket)
+            {
+                size_t pos = head_.load(std::memory_order_relaxed);
+                slot * cell;
+                for(;;)
+                {
+                    cell = &buffer_[pos & mask_];
+                    size_t seq = cell->seq.load(std::memory_order_acquire);
+                    intptr_t dif = (intptr_t) seq - (intptr_t) (pos + 1);
+                    if(dif == 0)
+                    {
+                        if(!multiCons)
+                        {
+                            head_.store(pos + 1, std::memory_order_relaxed);
+                            break;
+                        }
+                        if(head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if(dif < 0)
+                        return false;
+                    else
+                        pos = head_.load(std::memory_order_relaxed);
+                }
+                *toPull = cell->data;
+                cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+                ticket = pos + 1;
+                return true;
+            }
+            
+            //True when the next slot to pull has not been published yet
+            bool emptyNow(void)
+            {
+                size_t pos = head_.load(std::memory_order_acquire);
+                size_t seq = buffer_[pos & mask_].seq.load(std::memory_order_acquire);
+                return (intptr_t) seq - (intptr_t) (pos + 1) < 0;
+            }
+            
+            //True when the next slot to push has not been freed yet
+            bool fullNow(void)
+            {
+                size_t pos = tail_.load(std::memory_order_acquire);
+                size_t seq = buffer_[pos & mask_].seq.load(std::memory_order_acquire);
+                return (intptr_t) seq - (intptr_t) pos < 0;
+            }
+    };
 } //namespace darts
 
 #endif	/* RINGBUFFER_H */
@@ -0,0 +1,122 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef SLAB_H
+#define	SLAB_H
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <iostream>
+
+//Objects are rounded up to a multiple of SLAB_ALIGN, larger than SLAB_MAX_SIZE go to malloc
+#define SLAB_ALIGN 16
+#define SLAB_MAX_SIZE 512
+#define SLAB_CLASSES (SLAB_MAX_SIZE / SLAB_ALIGN)
+//Memory is taken from the system in chunks aligned on their size, one size class per chunk
+#define SLAB_CHUNK (64 * 1024)
+//Objects freed by another thread are sent back to their owner this many at a time
+#define SLAB_REMOTE_BATCH 32
+
+namespace darts
+{
+    /*
+     * Struct: slabStats
+     * Counters of one or more thread heaps. A remote free is one done by a
+     * thread that does not own the object, a reclaim is the owner taking
+     * back every object other threads returned to one of its size classes.
+     */
+    struct slabStats
+    {
+        uint64_t allocs;
+        uint64_t frees;
+        uint64_t remoteFrees;
+        uint64_t remoteBatches;
+        uint64_t reclaims;
+        uint64_t chunks;
+        uint64_t large;
+
+        slabStats(void):
+        allocs(0), frees(0), remoteFrees(0), remoteBatches(0),
+        reclaims(0), chunks(0), large(0) { }
+
+        void add(const slabStats & other)
+        {
+            allocs += other.allocs;
+            frees += other.frees;
+            remoteFrees += other.remoteFrees;
+            remoteBatches += other.remoteBatches;
+            reclaims += other.reclaims;
+            chunks += other.chunks;
+            large += other.large;
+        }
+
+        void print(std::ostream &out = std::cout) const
+        {
+            out << "allocs: " << allocs
+                << " frees: " << frees
+                << " remote frees: " << remoteFrees
+                << " remote batches: " << remoteBatches
+                << " reclaims: " << reclaims
+                << " chunks: " << chunks
+                << " (" << (chunks * SLAB_CHUNK) / 1024 << " KB)"
+                << " large: " << large << std::endl;
+        }
+    };
+
+    /*
+     * Per-thread size-class allocator used for TP frames and closures. Each
+     * thread allocates from its own free lists, an object freed by another
+     * thread is queued on the freeing thread and handed back to the owner's
+     * lock-free return list SLAB_REMOTE_BATCH at a time. The owner grabs the
+     * whole return list once its own list runs dry. The heap of a thread that
+     * exits is adopted by the next thread that needs one.
+     */
+    void * slabAlloc(size_t size);
+    void slabFree(void * ptr, size_t size);
+    
+    //Sends the calling thread's queued remote frees back to their owners
+    void slabFlush(void);
+    
+    //Sum over every heap, only exact when no thread is allocating
+    void getSlabStats(slabStats & stats);
+
+    /*
+     * Struct: slabAllocated
+     * Inherit from it to have a class allocated by the slab allocator, e.g.
+     * class fib : public ThreadedProcedure, public slabAllocated. Deleting
+     * through a base pointer needs a virtual destructor, as for any TP.
+     */
+    struct slabAllocated
+    {
+        static void * operator new(size_t size) { return slabAlloc(size); }
+        static void operator delete(void * ptr, size_t size) { slabFree(ptr, size); }
+        static void * operator new(size_t, void * where) { return where; }
+        static void operator delete(void *, void *) { }
+    };
+
+} // namespace darts
+#endif	/* SLAB_H */
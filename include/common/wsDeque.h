@@ -0,0 +1,209 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef WSDEQUE_H
+#define	WSDEQUE_H
+#include <stdint.h>
+#include <atomic>
+
+namespace darts
+{
+    /*
+     * Class: wsDeque
+     * Lock-free work-stealing deque (Chase-Lev, with the memory orderings of
+     * Le et al. "Correct and Efficient Work-Stealing for Weak Memory Models").
+     * Only the owner thread may call push and take; they work on the bottom
+     * of the deque and only use an atomic RMW when racing a thief for the last
+     * element. Any thread may call steal, which takes from the top.
+     * The circular array grows when full. Old arrays are kept until the deque
+     * is destroyed since a thief may still be reading from them.
+     * T has to be a pointer-like type, 0 is returned when the deque is empty.
+     */
+    template <class T>
+    class wsDeque
+    {
+    private:
+        struct ringArray
+        {
+            int64_t size;
+            int64_t mask;
+            std::atomic<T> * items;
+            ringArray * retired;
+
+            ringArray(int64_t theSize):
+            size(theSize),
+            mask(theSize - 1),
+            items(new std::atomic<T>[theSize]),
+            retired(0) { }
+
+            ~ringArray(void)
+            {
+                delete [] items;
+            }
+
+            T get(int64_t i) const
+            {
+                return items[i & mask].load(std::memory_order_relaxed);
+            }
+
+            void put(int64_t i, T x)
+            {
+                items[i & mask].store(x, std::memory_order_relaxed);
+            }
+
+            ringArray * grow(int64_t bottom, int64_t top)
+            {
+                ringArray * temp = new ringArray(size << 1);
+                for(int64_t i = top; i < bottom; i++)
+                    temp->put(i, get(i));
+                temp->retired = this;
+                return temp;
+            }
+        };
+
+        std::atomic<int64_t> top_;
+        char pad1[64-sizeof(std::atomic<int64_t>)];
+        std::atomic<int64_t> bottom_;
+        char pad2[64-sizeof(std::atomic<int64_t>)];
+        std::atomic<ringArray*> array_;
+
+        //Not copyable, thieves hold pointers into the array
+        wsDeque(const wsDeque &);
+        wsDeque & operator=(const wsDeque &);
+    public:
+        //The size has to be a power of 2
+        wsDeque(int64_t size = 64):
+        top_(0),
+        bottom_(0),
+        array_(new ringArray(size)) { }
+
+        ~wsDeque(void)
+        {
+            ringArray * temp = array_.load(std::memory_order_relaxed);
+            while(temp)
+            {
+                ringArray * next = temp->retired;
+                delete temp;
+                temp = next;
+            }
+        }
+
+        //Owner only
+        void push(T x)
+        {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_acquire);
+            ringArray * a = array_.load(std::memory_order_relaxed);
+            if(b - t > a->size - 1)
+            {
+                a = a->grow(b, t);
+                array_.store(a, std::memory_order_release);
+            }
+            a->put(b, x);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+
+        //Owner only, publishes all n items with a single store
+        void pushBatch(const T * x, size_t n)
+        {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_acquire);
+            ringArray * a = array_.load(std::memory_order_relaxed);
+            while(b - t + static_cast<int64_t>(n) > a->size)
+            {
+                a = a->grow(b, t);
+                array_.store(a, std::memory_order_release);
+            }
+            for(size_t i = 0; i < n; i++)
+                a->put(b + static_cast<int64_t>(i), x[i]);
+            std::atomic_thread_fence(std::memory_order_release);
+            bottom_.store(b + static_cast<int64_t>(n), std::memory_order_relaxed);
+        }
+
+        //Owner only, LIFO end
+        T take(void)
+        {
+            int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+            ringArray * a = array_.load(std::memory_order_relaxed);
+            bottom_.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t t = top_.load(std::memory_order_relaxed);
+            T x = 0;
+            if(t <= b)
+            {
+                x = a->get(b);
+                if(t == b)
+                {
+                    //Last element, race the thieves for it
+                    if(!top_.compare_exchange_strong(t, t + 1,
+                            std::memory_order_seq_cst, std::memory_order_relaxed))
+                        x = 0;
+                    bottom_.store(b + 1, std::memory_order_relaxed);
+                }
+            }
+            else
+                bottom_.store(b + 1, std::memory_order_relaxed);
+            return x;
+        }
+
+        //Any thread, FIFO end. Returns 0 when empty or when losing a race
+        T steal(void)
+        {
+            int64_t t = top_.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t b = bottom_.load(std::memory_order_acquire);
+            if(t < b)
+            {
+                ringArray * a = array_.load(std::memory_order_acquire);
+                T x = a->get(t);
+                if(!top_.compare_exchange_strong(t, t + 1,
+                        std::memory_order_seq_cst, std::memory_order_relaxed))
+                    return 0;
+                return x;
+            }
+            return 0;
+        }
+
+        bool empty(void) const
+        {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_relaxed);
+            return (b <= t);
+        }
+
+        size_t size(void) const
+        {
+            int64_t b = bottom_.load(std::memory_order_relaxed);
+            int64_t t = top_.load(std::memory_order_relaxed);
+            return (b > t) ? static_cast<size_t>(b - t) : 0;
+        }
+    };
+} //namespace darts
+
+#endif	/* WSDEQUE_H */
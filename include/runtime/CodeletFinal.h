@@ -29,6 +29,7 @@
 #ifndef CODELETFINAL_H
 #define	CODELETFINAL_H
 #include "Codelet.h"
+#include "Lock.h"
 namespace darts
 {
     class CodeletFinal : public Codelet
@@ -37,6 +38,8 @@ namespace darts
         Scheduler ** aliveSig;
         unsigned int numThreads;
         bool terminate;
+        //The elastic pool adds and removes workers while termination may be killing them
+        Lock aliveLock;
     public:
         CodeletFinal() :
         Codelet(1, 1),
@@ -53,7 +56,21 @@ namespace darts
         {
             assert(index < numThreads);
 
-            aliveSig[index] = toAdd;
+            aliveLock.lock();
+            if (aliveSig)
+                aliveSig[index] = toAdd;
+            aliveLock.unlock();
+        }
+        
+        //A worker stopped by the elastic pool is not killed again on termination
+        void removeAliveSignal(size_t index)
+        {
+            assert(index < numThreads);
+
+            aliveLock.lock();
+            if (aliveSig)
+                aliveSig[index] = 0;
+            aliveLock.unlock();
         }
 
         void setNumThreads(size_t num)
@@ -66,15 +83,19 @@ namespace darts
 
         virtual void decDep(void)
         {
+            aliveLock.lock();
             if (terminate)
             {
                 for (unsigned int i = 0; i < numThreads; i++)
                 {
-                    aliveSig[i]->kill();
+                    if (aliveSig[i])
+                        aliveSig[i]->kill();
                 }
                 delete [] aliveSig;
+                aliveSig = 0;
             } else
                 aliveSig[0]->kill();
+            aliveLock.unlock();
         }
 
         virtual void fire(void){ };
@@ -0,0 +1,124 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COMPLETION_H
+#define	COMPLETION_H
+#include <atomic>
+#include <climits>
+#include "Codelet.h"
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+#include <unistd.h>
+
+//Polls of the done flag before a waiter blocks
+#define COMPLETION_SPINS 1024
+
+namespace darts
+{
+    /*
+     * Class: Completion
+     * Handle on a graph started with Runtime::submit. Pass it as the codelet
+     * the root TP signals when it is done; any thread, including one that is
+     * not part of the runtime, can then poll it with test or block in wait.
+     * An optional continuation codelet is signaled on completion, before the
+     * waiters are released. The handle can be reused once it was reset.
+     */
+    class Completion : public Codelet
+    {
+    private:
+        Codelet * then_;
+        std::atomic<uint32_t> done_;
+        std::atomic<uint32_t> waiters_;
+        //Set while decDep still touches the handle, so a waiter does not free it under us
+        std::atomic<uint32_t> signaling_;
+
+    public:
+        Completion(uint32_t dep = 1, Codelet * then = NULL):
+        Codelet(dep, dep),
+        then_(then),
+        done_(0),
+        waiters_(0),
+        signaling_(0) { }
+
+        virtual void decDep(void)
+        {
+            if(!sync_.decCounter())
+                return;
+            signaling_.store(1, std::memory_order_relaxed);
+            if(then_)
+                then_->decDep();
+            done_.store(1, std::memory_order_seq_cst);
+#ifdef __linux__
+            if(waiters_.load(std::memory_order_seq_cst))
+                syscall(SYS_futex, reinterpret_cast<uint32_t*>(&done_), FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+#endif
+            signaling_.store(0, std::memory_order_release);
+        }
+
+        virtual void fire(void) { }
+
+        //True once the graph signaled us
+        bool test(void) const
+        {
+            return done_.load(std::memory_order_acquire) && !signaling_.load(std::memory_order_acquire);
+        }
+
+        //Blocks the calling thread until the graph signaled us
+        void wait(void)
+        {
+            for(unsigned int i = 0; i < COMPLETION_SPINS && !done_.load(std::memory_order_acquire); i++)
+                ;
+            while(!done_.load(std::memory_order_acquire))
+            {
+#ifdef __linux__
+                waiters_.fetch_add(1, std::memory_order_seq_cst);
+                if(!done_.load(std::memory_order_seq_cst))
+                    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&done_), FUTEX_WAIT_PRIVATE, 0, NULL, NULL, 0);
+                waiters_.fetch_sub(1, std::memory_order_relaxed);
+#else
+                usleep(10);
+#endif
+            }
+            while(signaling_.load(std::memory_order_acquire))
+                ;
+        }
+
+        //Rearms the handle, only call it once the previous graph completed
+        void reset(void)
+        {
+            resetCodelet();
+            done_.store(0, std::memory_order_relaxed);
+        }
+
+        void setThen(Codelet * then) { then_ = then; }
+    };
+
+} // namespace darts
+#endif	/* COMPLETION_H */
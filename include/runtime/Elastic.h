@@ -0,0 +1,122 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ELASTIC_H
+#define	ELASTIC_H
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+//How often the runtime samples the TP schedulers, in microseconds
+#define ELASTIC_PERIOD_US 50000
+
+namespace darts
+{
+    /*
+     * Struct: workerSample
+     * What the runtime saw of one TP scheduler and its MC workers since the
+     * previous sample. Times are in ns, the park counters cover the workers
+     * running when the sample was taken.
+     */
+    struct workerSample
+    {
+        unsigned int tp;
+        size_t workers;
+        size_t maxWorkers;
+        size_t queueDepth;
+        uint64_t period;
+        uint64_t parks;
+        uint64_t parkedTime;
+
+        workerSample(void):
+        tp(0), workers(0), maxWorkers(0), queueDepth(0),
+        period(0), parks(0), parkedTime(0) { }
+
+        //Fraction of the period the workers spent parked
+        double idleRatio(void) const
+        {
+            return (period && workers) ? (double) parkedTime / (period * workers) : 0.0;
+        }
+    };
+
+    /*
+     * Class: ElasticPolicy
+     * Hook deciding how many MC workers a TP scheduler should run. The
+     * runtime calls target from its monitor thread once per period and TP
+     * scheduler, then starts or stops workers one at a time to get there.
+     * The answer is clamped between 1 and maxWorkers.
+     */
+    class ElasticPolicy
+    {
+    public:
+        virtual ~ElasticPolicy(void) { }
+        
+        virtual size_t target(const workerSample & sample) = 0;
+    };
+
+    /*
+     * Class: QueueDepthPolicy
+     * Adds a worker while more than growDepth codelets per worker are waiting,
+     * removes one once the queue stayed empty and the workers were parked for
+     * more than shrinkIdle of the time for shrinkAfter samples in a row.
+     */
+    class QueueDepthPolicy : public ElasticPolicy
+    {
+    private:
+        size_t growDepth_;
+        double shrinkIdle_;
+        unsigned int shrinkAfter_;
+        std::vector<unsigned int> calm_;
+    public:
+        QueueDepthPolicy(size_t growDepth = 2, double shrinkIdle = 0.75, unsigned int shrinkAfter = 3):
+        growDepth_(growDepth),
+        shrinkIdle_(shrinkIdle),
+        shrinkAfter_(shrinkAfter) { }
+        
+        size_t target(const workerSample & sample)
+        {
+            if(calm_.size() <= sample.tp)
+                calm_.resize(sample.tp + 1, 0);
+            if(sample.queueDepth > sample.workers * growDepth_)
+            {
+                calm_[sample.tp] = 0;
+                return sample.workers + 1;
+            }
+            if(sample.queueDepth || sample.idleRatio() < shrinkIdle_)
+            {
+                calm_[sample.tp] = 0;
+                return sample.workers;
+            }
+            if(++calm_[sample.tp] < shrinkAfter_)
+                return sample.workers;
+            calm_[sample.tp] = 0;
+            return sample.workers - 1;
+        }
+    };
+
+} // namespace darts
+#endif	/* ELASTIC_H */
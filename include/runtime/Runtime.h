@@ -32,9 +32,13 @@
 #include "MicroScheduler.h"
 #include "AbstractMachine.h"
 #include "CodeletFinal.h"
+#include "Completion.h"
+#include "Elastic.h"
+#include "Lock.h"
 #include "Thread.h"
 #include "threadlocal.h"
 #include "Affinity.h"
+#include "taskGraph.h"
 
 namespace darts
 {
@@ -46,6 +50,7 @@ namespace darts
         unsigned int threadId;
         unsigned int clusterId;
         unsigned int tpSched;
+        unsigned int homeCluster;
     };
     
     struct mcRuntimeArgs
@@ -76,16 +81,55 @@ namespace darts
         volatile unsigned int mccount_;
         volatile unsigned int fullcount_;
         volatile bool spin_;
+        //TP scheduler 0 runs on a service thread between start and stop
+        volatile bool serving_;
+        volatile unsigned int nextSubmit_;
+        Lock serveLock_;
+        //MC slots whose worker thread is running
+        volatile bool * mcRunning_;
+        //Elastic pool: membership changes and the monitor thread sampling the schedulers
+        Lock elasticLock_;
+        Thread monitor_;
+        ElasticPolicy * elastic_;
+        useconds_t elasticPeriod_;
+        volatile bool monitoring_;
+        parkStats * lastPark_;
+        uint64_t lastSample_;
+        
+        unsigned int clusterOfCore(unsigned int core) const;
     public:
         static CodeletFinal finalSignal;
         Runtime(unsigned int maxCluster = -1, unsigned int maxWorker = -1);
         Runtime(ThreadAffinity * affinity);
         void run(tpClosure * tpToStart);
+        
+        /*
+         * Runs the graph of tpToStart and records it in graph the first
+         * time, later runs replay graph and only delete tpToStart, which can
+         * then be NULL. See <taskGraph> for the graphs that can be replayed.
+         */
+        void run(taskGraph & graph, tpClosure * tpToStart);
+        
+        /*
+         * Server mode: start hands TP scheduler 0 to a service thread so the
+         * runtime keeps running between requests, and submit queues a root TP
+         * from any thread, runtime or not. The root TP should signal a
+         * Completion to let the caller wait on it. stop does not wait for the
+         * submitted graphs and gives TP scheduler 0 back to its caller, run
+         * stops server mode first.
+         */
+        void start(void);
+        void stop(void);
+        void submit(tpClosure * tpToStart);
+        bool serving(void) const { return serving_; }
+        
         ~Runtime(void);
         unsigned int getNumTPS(void) {return numTPSched_;}
         unsigned int getNumMCS(void) {return numMCSched_;}
         TPScheduler * newTPSched(unsigned int id, unsigned int type) { return TPSched_[id] = TPScheduler::create(type); }
         MScheduler  * newMCSched(unsigned int id, unsigned int type) { return MCSched_[id] = MScheduler::create(type); }
+        TPScheduler * getTPSched(unsigned int id) { return TPSched_[id]; }
+        MScheduler  * getMCSched(unsigned int id) { return MCSched_[id]; }
         void decTP(void)   {         Atomics::fetchSub(tpcount_,   1U); }
         void decMC(void)   {         Atomics::fetchSub(mccount_,   1U); }
         void decFull(void) { if( 1== Atomics::fetchSub(fullcount_, 1U) ) spin_=false; }
@@ -103,6 +147,43 @@ namespace darts
 
         void linkTPSched(void);
         void linkMCSched(void);       
+        
+        //Codelets a TP scheduler hands to its MC schedulers at once, 1 disables batching
+        void setCodeletBatch(size_t batch) { for(unsigned int i=0;i<numTPSched_;i++) TPSched_[i]->setCodeletBatch(batch); }
+        
+        //Parking counters of every worker, only exact once run() returned
+        void getParkStats(parkStats & tpStats, parkStats & mcStats) const;
+        void printParkStats(std::ostream & out = std::cout) const;
+        
+        //Slab allocator counters of every thread that allocated TPs or closures
+        void printSlabStats(std::ostream & out = std::cout) const;
+        
+        //Streaming Fifos of every TP scheduler, live and waiting to be reused
+        void getFifoStats(fifoPoolStats & stats) const;
+        void printFifoStats(std::ostream & out = std::cout) const;
+        
+        /*
+         * Elastic pool: the MC workers of a TP scheduler can be stopped and
+         * started again while the runtime is live, between 1 and the number
+         * of workers per TP it was built with. removeWorker stops the last
+         * running worker and hands its queue back to the TP scheduler,
+         * addWorker restarts the first stopped one on its original core.
+         */
+        bool addWorker(unsigned int tp);
+        bool removeWorker(unsigned int tp);
+        size_t getNumWorkers(unsigned int tp) const { return TPSched_[tp]->getNumSub(); }
+        
+        /*
+         * Samples every TP scheduler each period and lets policy pick how many
+         * workers it runs. The runtime does not take ownership of policy,
+         * NULL stops the monitor. Parked time is only accounted when a park
+         * ends, so period should be a few times PARK_TIMEOUT_NS.
+         */
+        void setElasticPolicy(ElasticPolicy * policy, useconds_t period = ELASTIC_PERIOD_US);
+        void sampleWorkers(unsigned int tp, workerSample & sample);
+        void elasticTick(void);
+        bool monitoring(void) const { return monitoring_; }
+        useconds_t getElasticPeriod(void) const { return elasticPeriod_; }
     };
     
 } // namespace darts
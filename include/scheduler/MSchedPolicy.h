@@ -31,6 +31,8 @@
 #include "MicroScheduler.h"
 #include "ringbuffer.h"
 #include "dartsPool.h"
+#include "VictimSelect.h"
+#include "prioPool.h"
 
 #define THRESHOLD 4
 
@@ -44,7 +46,14 @@ namespace darts
         bool 
         pushCodelet(Codelet * codeletToPush)
         {
-            return buff.push(codeletToPush);
+            if(!beginPush())
+                return false;
+            bool ret = buff.push(codeletToPush);
+            endPush();
+            if(!ret)
+                return false;
+            wake();
+            return true;
         }
         
         bool
@@ -59,6 +68,30 @@ namespace darts
             return buff.pull();
         }
         
+        size_t
+        pushCodeletBatch(Codelet ** codeletsToPush, size_t n)
+        {
+            if(!beginPush())
+                return 0;
+            size_t ret = buff.pushBatch(codeletsToPush, n);
+            endPush();
+            if(ret)
+                wake();
+            return ret;
+        }
+        
+        size_t
+        popCodeletBatch(Codelet ** codeletsPopped, size_t max)
+        {
+            return buff.pullBatch(codeletsPopped, max);
+        }
+        
+        bool
+        hasWork(void)
+        {
+            return !buff.empty();
+        }
+        
         virtual void policy(void);
     };
        
@@ -71,7 +104,12 @@ namespace darts
         bool
         pushCodelet(Codelet * codeletToPush)
         {
-            return buff.push(codeletToPush);
+            if(!beginPush())
+                return false;
+            bool ret = buff.push(codeletToPush);
+            endPush();
+            wake();
+            return ret;
         }
         
         bool
@@ -86,6 +124,29 @@ namespace darts
             return buff.pop();
         }
         
+        size_t
+        pushCodeletBatch(Codelet ** codeletsToPush, size_t n)
+        {
+            if(!beginPush())
+                return 0;
+            size_t ret = buff.pushBatch(codeletsToPush, n);
+            endPush();
+            wake();
+            return ret;
+        }
+        
+        size_t
+        popCodeletBatch(Codelet ** codeletsPopped, size_t max)
+        {
+            return buff.popBatch(codeletsPopped, max);
+        }
+        
+        bool
+        hasWork(void)
+        {
+            return !buff.empty();
+        }
+        
         virtual void policy(void);
     };
     
@@ -104,18 +165,53 @@ namespace darts
             return false;
         }
         
+        bool
+        sharesParent(void)
+        {
+            return true;
+        }
+        
+        bool
+        hasWork(void)
+        {
+            return getParentScheduler()->hasCodelets();
+        }
+        
         virtual void policy(void);
     };
     
     class MicroSteal : public MScheduler
     {
     private:
-        dartsPool<Codelet*> buff;
+        dartsStealPool<Codelet*> buff;
+        VictimSelect victims_;
     public:
         
         MicroSteal(void)
         { local_ = true; }
         
+        //Siblings are only known once the runtime linked the schedulers, retired
+        //slots stay in the list so workers the elastic pool starts later are seen
+        void
+        bindThread(void)
+        {
+            buff.claim();
+            victims_.clear();
+            victims_.seed(getID());
+            TPScheduler * parent = getParentScheduler();
+            for(size_t i = 0; i < parent->getMaxSub(); i++)
+            {
+                if(parent->getSubScheduler(i) != this)
+                    victims_.addVictim(i, VICTIM_SIBLING);
+            }
+        }
+        
+        VictimSelect &
+        getVictimSelect(void)
+        {
+            return victims_;
+        }
+        
         bool 
         pushCodelet(Codelet *)
         {
@@ -128,31 +224,117 @@ namespace darts
             return buff.pop();
         }
         
+        size_t
+        popCodeletBatch(Codelet ** codeletsPopped, size_t max)
+        {
+            return buff.popBatch(codeletsPopped, max);
+        }
+        
         bool pushLocal(Codelet * codeletToPush)
         {
-            return buff.push(codeletToPush);
+            bool ret = buff.push(codeletToPush);
+            //Let an idle sibling steal it
+            getParentScheduler()->wakeSub();
+            return ret;
         }
         
+        bool
+        sharesParent(void)
+        {
+            return true;
+        }
+        
+        bool
+        hasWork(void)
+        {
+            return !buff.empty() || getParentScheduler()->hasCodelets();
+        }
+        
+        //Steals half of a sibling's codelets, then falls back on the parent's queue
         Codelet *
         stealCodelet(void)
         {
             TPScheduler * parent = getParentScheduler();
-            size_t numberOfPeers = parent->getNumSub();
-            uint64_t random = rand() % (numberOfPeers + 1);
-            if(random!=getID())
+            size_t victim;
+            victims_.begin();
+            while(victims_.next(victim))
             {
-                if(random==numberOfPeers)
-                {
-                    return parent->popCodelet();
-                }
-                else
-                {
-                    MicroSteal * victim = static_cast<MicroSteal*>(parent->getSubScheduler(random));
-                    return victim->popCodelet();
-                }
+                MicroSteal * peer = static_cast<MicroSteal*>(parent->getSubScheduler(victim));
+                Codelet * stolen = buff.stealHalf(peer->buff, STEAL_BATCH);
+                if(stolen)
+                    return stolen;
             }
-            return NULL;
+            return parent->popCodelet();
+        }
+        virtual void policy(void);
+    };
+    
+    class MicroPriority : public MScheduler
+    {
+    private:
+        prioPool<Codelet*, NUM_PRIO> buff;
+    public:
+        bool
+        pushCodelet(Codelet * codeletToPush)
+        {
+            if(!beginPush())
+                return false;
+            buff.push(codeletToPush, codeletToPush->getPriority());
+            endPush();
+            wake();
+            return true;
+        }
+        
+        //Released codelets go to the parent so every sibling sees them in priority order
+        bool
+        pushLocal(Codelet *)
+        {
+            return false;
+        }
+        
+        //Takes the parent's codelet when it is more urgent than our own
+        Codelet *
+        popCodelet(void)
+        {
+            TPScheduler * parent = getParentScheduler();
+            Codelet * temp = NULL;
+            if (parent->topPriority() > buff.topLevel())
+                temp = parent->popCodelet();
+            if (!temp)
+                temp = buff.pop();
+            if (!temp)
+                temp = parent->popCodelet();
+            return temp;
+        }
+        
+        //Only our own queue, used to hand it back when the worker stops
+        size_t
+        popCodeletBatch(Codelet ** codeletsPopped, size_t max)
+        {
+            size_t n = 0;
+            while (n < max && (codeletsPopped[n] = buff.pop()))
+                n++;
+            return n;
+        }
+        
+        bool
+        sharesParent(void)
+        {
+            return true;
         }
+        
+        bool
+        hasWork(void)
+        {
+            return !buff.empty() || getParentScheduler()->hasCodelets();
+        }
+        
+        void
+        setAgePeriod(unsigned int period)
+        {
+            buff.setAgePeriod(period);
+        }
+        
         virtual void policy(void);
     };
 }
@@ -29,6 +29,8 @@
 #pragma once
 //Containers
 #include <vector>
+#include <atomic>
+#include <sched.h>
 
 #include "getClock.h"
 //Codelets and TPs
@@ -44,7 +46,8 @@ namespace darts
     enum MICROSCHED {MCSTANDARD = 0, 
                      MCSTATIC   = 1,                 
                      MCDYNAMIC  = 2,
-                     MCSTEAL    = 3};
+                     MCSTEAL    = 3,
+                     MCPRIORITY = 4};
     
     class MScheduler : public Scheduler
     {
@@ -52,10 +55,40 @@ namespace darts
         TPScheduler * parent_;
     protected:
         bool local_;
+        //Set while the worker is stopped by the elastic pool, pushes are refused
+        std::atomic<bool> retired_;
+        //Pushes that passed the retired_ check and are not done yet
+        std::atomic<unsigned int> pushing_;
+        
+        /*
+         * Every push into our queue is bracketed by beginPush and endPush.
+         * beginPush fails once retire(true) is under way, and retire waits
+         * for the pushes already in, so nothing lands in the queue after
+         * the drain that follows it.
+         */
+        bool
+        beginPush(void)
+        {
+            pushing_.fetch_add(1);
+            if(retired_.load())
+            {
+                pushing_.fetch_sub(1);
+                return false;
+            }
+            return true;
+        }
+        
+        void
+        endPush(void)
+        {
+            pushing_.fetch_sub(1, std::memory_order_release);
+        }
     public:
         MScheduler(void):
         parent_(NULL),
-        local_(false){ }
+        local_(false),
+        retired_(false),
+        pushing_(0){ }
         
 	~MScheduler(void) {}
 
@@ -79,11 +112,69 @@ namespace darts
         
         virtual bool pushLocal(Codelet *) = 0;
         
+        /*Pushes codelets until one is refused, returns how many were taken*/
+        virtual size_t
+        pushCodeletBatch(Codelet ** codeletsToPush, size_t n)
+        {
+            size_t i = 0;
+            while(i < n && pushCodelet(codeletsToPush[i]))
+                i++;
+            return i;
+        }
+        
+        /*Pops up to max codelets from the scheduler's own queue*/
+        virtual size_t
+        popCodeletBatch(Codelet **, size_t)
+        {
+            return 0;
+        }
+        
         virtual bool empty(void)
         {
             return false;
         }
         
+        /*Once retire(true) returns no push is in flight and later ones are refused*/
+        void
+        retire(bool isRetired)
+        {
+            retired_.store(isRetired);
+            while(isRetired && pushing_.load(std::memory_order_acquire))
+                sched_yield();
+        }
+        
+        bool retired(void) const { return retired_.load(std::memory_order_relaxed); }
+        
+        /*Hands the codelets left in our own queue back to the parent, returns how many*/
+        size_t
+        drain(void)
+        {
+            Codelet * batch[CODELET_BATCH];
+            size_t total = 0;
+            size_t n;
+            while((n = popCodeletBatch(batch, CODELET_BATCH)))
+            {
+                size_t done = 0;
+                while(done < n)
+                    done += parent_->pushCodeletBatch(&batch[done], n - done);
+                total += n;
+            }
+            return total;
+        }
+        
+        /*True if the policy pops codelets straight from the parent's queue*/
+        virtual bool sharesParent(void)
+        {
+            return false;
+        }
+        
+        void
+        parking(bool isParking)
+        {
+            if(sharesParent())
+                parent_->subParking(isParking);
+        }
+        
         static MScheduler * create(unsigned int type);
     };
 }
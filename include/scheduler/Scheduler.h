@@ -37,6 +37,8 @@
 #endif
 
 #include "Affinity.h"
+#include "Parker.h"
+#include "ThreadedProcedure.h"
 
 #ifdef TRACE
 #include <vector>
@@ -80,6 +82,8 @@ namespace darts
         
 	ThreadAffinity * affin_;
 	
+        Parker parker_;
+        
 #ifdef TRACE
         std::vector<record> schedTrace_;
 #endif
@@ -128,6 +132,7 @@ namespace darts
         kill(void)
         {
             alive_ = false;
+            parker_.notify();
         }
 
         void
@@ -143,6 +148,71 @@ namespace darts
         }
         
         virtual void policy(void) = 0;
+        
+        /*Called from the thread that will run policy() before it starts*/
+        virtual void bindThread(void) { }
+        
+        /*Last check done before parking, true if there is work to grab*/
+        virtual bool hasWork(void) { return false; }
+        
+        /*Called by the worker right before it parks and after it resumes*/
+        virtual void parking(bool) { }
+        
+        /*Wakes the worker up if it is parked*/
+        bool
+        wake(void)
+        {
+            return parker_.notify();
+        }
+        
+        bool
+        parked(void) const
+        {
+            return parker_.parked();
+        }
+        
+        const parkStats &
+        getParkStats(void) const
+        {
+            return parker_.getStats();
+        }
+        
+        /*
+         * Called by the policy loop when it found nothing to do. Spins for
+         * PARK_SPINS calls and then parks on the worker's futex until a
+         * producer wakes it up. spins must be reset to 0 once work is found.
+         * The TP references the worker deferred are folded first.
+         */
+        void
+        idle(unsigned int & spins)
+        {
+            ThreadedProcedure::foldRefs();
+            if(spins == PARKED)
+            {
+                parker_.spurious();
+                spins = PARK_SPINS;
+            }
+            if(spins < PARK_SPINS)
+            {
+                spins++;
+#if defined(__x86_64__) || defined(__i386__)
+                __asm__ __volatile__("pause" ::: "memory");
+#endif
+                return;
+            }
+            parking(true);
+            uint32_t epoch = parker_.prepare();
+            if(!alive_ || hasWork())
+                parker_.cancel();
+            else
+            {
+                parker_.wait(epoch);
+                spins = PARKED;
+            }
+            parking(false);
+        }
+        
+        static const unsigned int PARKED = ~0U;
 
 #ifdef TRACE       
 
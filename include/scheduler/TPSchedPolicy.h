@@ -29,6 +29,7 @@
 #pragma once
 #include "TPScheduler.h"
 #include "Codelet.h"
+#include "prioPool.h"
 #include <stdlib.h>
 
 
@@ -53,8 +54,9 @@ namespace darts
         size_t
         getSubIndexInc(void)
         {
-            size_t temp = whichSub_;
-            whichSub_ = (whichSub_ + 1) % getNumSub();
+            size_t numSub = getNumSub();
+            size_t temp = (whichSub_ < numSub) ? whichSub_ : 0;
+            whichSub_ = (temp + 1) % numSub;
             return temp;
         }
 
@@ -91,8 +93,9 @@ namespace darts
         size_t
         getSubIndexInc(void)
         {
-            size_t temp = whichSub_;
-            whichSub_ = (whichSub_ + 1) % getNumSub();
+            size_t numSub = getNumSub();
+            size_t temp = (whichSub_ < numSub) ? whichSub_ : 0;
+            whichSub_ = (temp + 1) % numSub;
             return temp;
         }
 
@@ -118,6 +121,8 @@ namespace darts
         bool
         pushCodelet(Codelet * CodeletToPush);
 
+        size_t
+        pushCodeletBatch(Codelet ** codeletsToPush, size_t n);
     };
     
     class TPDynamic : public TPScheduler
@@ -147,15 +152,18 @@ namespace darts
         size_t
         getSubIndexInc(void)
         {
-            size_t temp = whichMC_;
-            whichMC_ = (whichMC_ + 1) % getNumSub();
+            size_t numSub = getNumSub();
+            size_t temp = (whichMC_ < numSub) ? whichMC_ : 0;
+            whichMC_ = (temp + 1) % numSub;
             return temp;
         }
         
         bool
         takeTP(tpClosure * aTP)
         {
-            return ready_.push(aTP);
+            bool ret = ready_.push(aTP);
+            wake();
+            return ret;
         }
         
         virtual bool 
@@ -174,4 +182,70 @@ namespace darts
         }
 
     };    
+
+    class TPPriority : public TPScheduler
+    {
+    private:
+        prioPool<Codelet*, NUM_PRIO> prio_;
+    public:
+        void policy(void);
+        
+        bool
+        pushCodelet(Codelet * CodeletToPush)
+        {
+            prio_.push(CodeletToPush, CodeletToPush->getPriority());
+            wake();
+            wakeSub();
+            return true;
+        }
+        
+        Codelet *
+        popCodelet(void)
+        {
+            return prio_.pop();
+        }
+        
+        size_t
+        pushCodeletBatch(Codelet ** codeletsToPush, size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+                prio_.push(codeletsToPush[i], codeletsToPush[i]->getPriority());
+            wake();
+            wakeSub(n);
+            return n;
+        }
+        
+        size_t
+        popCodeletBatch(Codelet ** codeletsPopped, size_t max)
+        {
+            size_t n = 0;
+            while (n < max && (codeletsPopped[n] = prio_.pop()))
+                n++;
+            return n;
+        }
+        
+        bool
+        hasCodelets(void)
+        {
+            return !prio_.empty();
+        }
+        
+        int
+        topPriority(void)
+        {
+            return prio_.topLevel();
+        }
+        
+        size_t
+        queueDepth(void)
+        {
+            return ready_.size() + prio_.size();
+        }
+        
+        void
+        setAgePeriod(unsigned int period)
+        {
+            prio_.setAgePeriod(period);
+        }
+    };
 }
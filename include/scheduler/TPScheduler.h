@@ -34,6 +34,11 @@
 #include <stdlib.h>
 #include "Fifo.h"
 #include "dartsPool.h"
+#include "VictimSelect.h"
+#include <atomic>
+
+//Most codelets a TP scheduler moves to its children at once
+#define CODELET_BATCH 32
 
 #ifdef TRACE
 #include "getClock.h"
@@ -45,7 +50,8 @@ namespace darts
                   TPROUNDROBIN    = 1, 
                   TPSTATIC        = 2,
                   TPDYNAMIC       = 3,
-                  TPWORKPUSH      = 4};
+                  TPWORKPUSH      = 4,
+                  TPPRIORITY      = 5};
 
 
     class TPScheduler : public Scheduler
@@ -54,23 +60,34 @@ namespace darts
         size_t numberOfPeers;
         TPScheduler** peers_;
         std::vector<Scheduler*> children_;
+        //Children currently running, always the first numSub_ slots of children_
+        std::atomic<size_t> numSub_;
+        //Children that pop from our codelet queue and are about to park
+        std::atomic<unsigned int> idleSubs_;
+        VictimSelect defaultVictims_;
+        VictimSelect * victims_;
+        size_t codeletBatch_;
         
     protected:
-        dartsPool<tpClosure*> ready_;
-        dartsPool<Codelet*> codelets_;
-	dartsPool<Fifo*> fifos_;
+        dartsStealPool<tpClosure*> ready_;
+        dartsStealPool<Codelet*> codelets_;
+        //Every Fifo this scheduler wired, in use or waiting to be reused
+        FifoPool fifos_;
 
     public:
         
         TPScheduler(void):
         numberOfPeers(0),
-        peers_(NULL)
+        peers_(NULL),
+        numSub_(0),
+        idleSubs_(0),
+        victims_(&defaultVictims_),
+        codeletBatch_(CODELET_BATCH)
         {
             
         }
         
-	// do I need to free Fifos here for now?
-	~TPScheduler(void){ }
+	~TPScheduler(void){ clearFifos(); }
 
         Scheduler *
         getSubScheduler(size_t pos) const
@@ -84,14 +101,30 @@ namespace darts
         setSubScheduler(Scheduler * aSub)
         {
             children_.push_back(aSub);
+            numSub_.store(children_.size());
         }
 
+        /*Number of running children, the ones codelets are handed to*/
         size_t 
         getNumSub(void) const
+        {
+            return numSub_.load(std::memory_order_relaxed);
+        }
+        
+        /*Number of child slots, running or retired*/
+        size_t
+        getMaxSub(void) const
         {
             return children_.size();
         }
         
+        /*Only the runtime changes this, once the slot's worker is started or stopped*/
+        void
+        setNumSub(size_t num)
+        {
+            numSub_.store((num < children_.size()) ? num : children_.size());
+        }
+        
         void addPeer(TPScheduler * toAdd, size_t pos)
         {
             peers_[pos] = toAdd;
@@ -119,37 +152,210 @@ namespace darts
             return 0;
         }
         
+        /*Wakes up one parked peer so it can steal from us*/
+        void
+        wakePeer(void)
+        {
+            for(size_t i = 0; i < numberOfPeers; i++)
+            {
+                if(peers_[i] != this && peers_[i]->parked() && peers_[i]->wake())
+                    return;
+            }
+        }
+        
+        /*A child that pops from our codelet queue is parking (or resuming)*/
+        void
+        subParking(bool parking)
+        {
+            if(parking)
+                idleSubs_.fetch_add(1);
+            else
+                idleSubs_.fetch_sub(1);
+        }
+        
+        /*True when one of our children or one of our peers is parked*/
+        bool
+        hasIdle(void)
+        {
+            if(idleSubs_.load(std::memory_order_relaxed))
+                return true;
+            for(size_t i = 0; i < numberOfPeers; i++)
+            {
+                if(peers_[i] != this && peers_[i]->parked())
+                    return true;
+            }
+            return false;
+        }
+
+        /*Wakes up to count parked children that pop from our codelet queue*/
+        void
+        wakeSub(size_t count = 1)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(!idleSubs_.load(std::memory_order_relaxed))
+                return;
+            size_t numSub = getNumSub();
+            for(size_t i = 0; i < numSub && count; i++)
+            {
+                if(children_[i]->parked() && children_[i]->wake())
+                    count--;
+            }
+        }
+        
+        /*How many codelets the policy hands out at once, 1 disables batching*/
+        void
+        setCodeletBatch(size_t batch)
+        {
+            codeletBatch_ = (batch < 1) ? 1 : (batch > CODELET_BATCH) ? CODELET_BATCH : batch;
+        }
+        
+        size_t
+        getCodeletBatch(void) const
+        {
+            return codeletBatch_;
+        }
+        
+        /*Order in which steal() visits the peers, indexed like getPeer*/
+        VictimSelect *
+        getVictimSelect(void)
+        {
+            return victims_;
+        }
+        
+        /*The scheduler does not take ownership of aVictimSelect*/
+        void
+        setVictimSelect(VictimSelect * aVictimSelect)
+        {
+            victims_ = (aVictimSelect) ? aVictimSelect : &defaultVictims_;
+        }
+        
+        /*
+         * One bounded sweep over the victims, closest first. Takes half of
+         * the first non empty queue found, except across sockets where a
+         * single TP is moved.
+         */
         tpClosure *
         steal(void)
         {
-            if(numberOfPeers)
+            size_t victim;
+            victims_->begin();
+            while(victims_->next(victim))
             {
-                uint64_t random = rand() % numberOfPeers;
-                if(random!=getID())
-                {
-                    return peers_[random]->popTP();
-                }
+                TPScheduler * peer = peers_[victim];
+                if(peer == this)
+                    continue;
+                size_t batch = (victims_->level() < VICTIM_REMOTE) ? STEAL_BATCH : 0;
+                tpClosure * stolen = ready_.stealHalf(peer->ready_, batch);
+                if(stolen)
+                    return stolen;
             }
             return NULL;
         }  
 
+        /*
+         * Connects a streaming producer to its consumers through the Fifo
+         * variant its generateFifo picks. The first producer of a fan-in
+         * creates the Fifo and makes the consumers ready, the next ones
+         * share it. The Fifo comes from our pool, recycled when one of the
+         * same shape was handed back. Returns the Fifo when it was created
+         * here, NULL otherwise.
+         */
+        Fifo *
+        wireFifo(Codelet * producerCod)
+        {
+            Codelet * first = producerCod->getConsumerCod();
+            Fifo * streamFifo = first->getProducer();
+            Fifo * created = NULL;
+            if(!streamFifo)
+            {
+                created = producerCod->generateFifo(0, 0, 0, STREAM_FIFO_SIZE, first, &fifos_);
+                streamFifo = first->claimProducer(created);
+                if(streamFifo)
+                {
+                    fifos_.give(created);
+                    created = NULL;
+                }
+                else
+                    streamFifo = created;
+            }
+            producerCod->setConsumer(streamFifo);
+            producerCod->setOutputLane(streamFifo->attachProducer());
+            if(created)
+            {
+                for(uint64_t i = 1; i < producerCod->getNumConsumerCods(); i++)
+                {
+                    Codelet * consumer = producerCod->getConsumerCodAt(i);
+                    consumer->setProducer(created);
+                    consumer->setInputLane(i);
+                }
+                //consumers should have only 1 dep; all others are intrinsic through producer Codelet
+                producerCod->decDepConsumerCod();
+            }
+            return created;
+        }
+
 	void
 	clearFifos(void)
 	{
-            while(!fifos_.empty()) {
-                Fifo * tmp = fifos_.pop();
-                if (tmp) {
-                    delete tmp;
-		}
-            }
+            fifos_.clear();
 	}
         
+        FifoPool *
+        getFifoPool(void)
+        {
+            return &fifos_;
+        }
+        
+        fifoPoolStats
+        getFifoStats(void)
+        {
+            return fifos_.getStats();
+        }
+        
         virtual void policy(void) = 0;
+        
+        void
+        bindThread(void)
+        {
+            ready_.claim();
+            codelets_.claim();
+            victims_->seed(getID());
+        }
+        
+        bool
+        hasWork(void)
+        {
+            return !ready_.empty() || hasCodelets();
+        }
+        
+        virtual bool
+        hasCodelets(void)
+        {
+            return !codelets_.empty();
+        }
+        
+        /*TPs and codelets waiting in our queues, codelets handed to children are not counted*/
+        virtual size_t
+        queueDepth(void)
+        {
+            return ready_.size() + codelets_.size();
+        }
+        
+        /*Priority of the most urgent queued codelet, -1 when there is none*/
+        virtual int
+        topPriority(void)
+        {
+            return (codelets_.empty()) ? -1 : 0;
+        }
                 
         virtual bool 
         pushTP(tpClosure * TPtoPush)
         {
-            return ready_.push(TPtoPush);
+            bool ret = ready_.push(TPtoPush);
+            //If we are awake let an idle peer steal the extra work
+            if(!wake() && ready_.size() > 1)
+                wakePeer();
+            return ret;
         }
         
         virtual tpClosure * 
@@ -161,7 +367,10 @@ namespace darts
         virtual bool 
         pushCodelet(Codelet * CodeletToPush)
         {
-            return codelets_.push(CodeletToPush);
+            bool ret = codelets_.push(CodeletToPush);
+            wake();
+            wakeSub();
+            return ret;
         }
         
         virtual Codelet * 
@@ -170,6 +379,23 @@ namespace darts
             return codelets_.pop();
         }
         
+        /*Pushes n codelets with one queue operation and one wake up*/
+        virtual size_t
+        pushCodeletBatch(Codelet ** codeletsToPush, size_t n)
+        {
+            size_t ret = codelets_.pushBatch(codeletsToPush, n);
+            wake();
+            wakeSub(ret);
+            return ret;
+        }
+        
+        /*Pops up to max codelets, returns how many were popped*/
+        virtual size_t
+        popCodeletBatch(Codelet ** codeletsPopped, size_t max)
+        {
+            return codelets_.popBatch(codeletsPopped, max);
+        }
+        
         static TPScheduler * create(unsigned int type);
 
 	//virtual Fifo *
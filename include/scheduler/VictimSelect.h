@@ -0,0 +1,156 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include "fastRand.h"
+
+//Victims tried per level before moving on to the next one
+#define VICTIM_RETRIES 4
+//Most items moved by a single steal-half
+#define STEAL_BATCH 32
+
+namespace darts
+{
+    enum VICTIMLEVEL {VICTIM_SIBLING = 0,
+                      VICTIM_SOCKET  = 1,
+                      VICTIM_REMOTE  = 2};
+
+    /*
+     * Class: VictimSelect
+     * Decides which victims a thief tries, and in which order, during one
+     * steal sweep. Victims are indices grouped in levels of increasing
+     * distance. A sweep walks the levels in order, starting each level at a
+     * random victim and trying at most retries victims per level, so it is
+     * bounded and never picks the same victim twice. Subclass and override
+     * begin/next to plug in a different order.
+     * Only the owning thread may call begin and next.
+     */
+    class VictimSelect
+    {
+    protected:
+        std::vector< std::vector<size_t> > levels_;
+        unsigned int retries_;
+        unsigned int maxLevel_;
+        fastRand rng_;
+        //Sweep state
+        unsigned int level_;
+        size_t tried_;
+        size_t start_;
+
+    public:
+        VictimSelect(void):
+        retries_(VICTIM_RETRIES),
+        maxLevel_(VICTIM_REMOTE),
+        level_(0),
+        tried_(0),
+        start_(0) { }
+
+        virtual ~VictimSelect(void) { }
+
+        void
+        addVictim(size_t victim, unsigned int level)
+        {
+            if(levels_.size() <= level)
+                levels_.resize(level + 1);
+            levels_[level].push_back(victim);
+        }
+
+        void
+        clear(void)
+        {
+            levels_.clear();
+        }
+
+        void
+        seed(uint64_t theSeed)
+        {
+            rng_.setSeed(theSeed);
+        }
+
+        void
+        setRetries(unsigned int retries)
+        {
+            retries_ = retries;
+        }
+
+        //Deepest level a sweep may reach, i.e. VICTIM_SOCKET disables remote steals
+        void
+        setMaxLevel(unsigned int maxLevel)
+        {
+            maxLevel_ = maxLevel;
+        }
+
+        //Level of the last victim returned by next
+        unsigned int
+        level(void) const
+        {
+            return level_;
+        }
+
+        size_t
+        numVictims(void) const
+        {
+            size_t total = 0;
+            for(size_t i = 0; i < levels_.size(); i++)
+                total += levels_[i].size();
+            return total;
+        }
+
+        //Starts a new sweep
+        virtual void
+        begin(void)
+        {
+            level_ = 0;
+            tried_ = 0;
+        }
+
+        //Next victim of the sweep, false once the sweep is over
+        virtual bool
+        next(size_t & victim)
+        {
+            while(level_ < levels_.size() && level_ <= maxLevel_)
+            {
+                const std::vector<size_t> & victims = levels_[level_];
+                if(tried_ < victims.size() && tried_ < retries_)
+                {
+                    if(!tried_)
+                        start_ = rng_.next(victims.size());
+                    victim = victims[(start_ + tried_) % victims.size()];
+                    tried_++;
+                    return true;
+                }
+                level_++;
+                tried_ = 0;
+            }
+            return false;
+        }
+    };
+}
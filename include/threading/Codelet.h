@@ -38,6 +38,12 @@ namespace darts
     class ThreadedProcedure;    
     //This is also a forward declaration
     class Fifo;
+    class FifoPool;
+    class Codelet;
+    
+    //Direct entry of a sealed codelet, see <CodeletT>
+    typedef void (*codeletFire)(Codelet *);
+    
     /*
 		 * Class: Codelet
 		 * The codelet class is a virutal class. Use this class to instantiate codelets
@@ -56,6 +62,17 @@ namespace darts
 				 * The status of the codelet TODO: Explicit?
 				*/
         uint32_t status_;
+        
+        //CODELET_STREAMING and CODELET_SEALED, set by the subclasses so the
+        //schedulers do not ask each codelet. It sits in the padding after
+        //status_ so codelets do not grow
+        uint8_t kind_;
+
+        //Hands the ready codelet to the current worker's scheduler
+        void enqueue(void);
+        
+        //TPs hand their ready codelets over the same way
+        friend class ThreadedProcedure;
 
     protected:
                                 /*
@@ -68,6 +85,9 @@ namespace darts
 				 * Pointer to TP frame/context
 				*/
         ThreadedProcedure * myTP_;
+        
+        void setStreaming(void) { kind_ |= CODELET_STREAMING; }
+        void setSealed(void) { kind_ |= CODELET_SEALED; }
 
 
     public:
@@ -106,12 +126,26 @@ namespace darts
          */
 	virtual bool isStreaming() { return false; }
 
+        /**
+				 * Method: streaming
+         * Same as isStreaming without a virtual call, what the schedulers check
+         */
+        bool streaming(void) const { return kind_ & CODELET_STREAMING; }
+
 				/**
 				 * Method: decDep
          * Decrements the dependence counter of the codelet
          */
         virtual void decDep (void);
         
+				/**
+				 * Method: reschedule
+         * Makes the codelet ready again without going through its counter,
+         * what a Fifo does to wake up a parked streaming codelet. The
+         * codelet's TP reference is the one it took when it parked
+         */
+        void reschedule (void);
+        
 				/**
 				 * Method: resetCodelet
          * Resets the codelet
@@ -138,12 +172,32 @@ namespace darts
          */
         uint32_t getStatus (void) const;  
 
+        /**
+				 * Method: setPriority
+				 * Sets the priority (0 to NUM_PRIO-1) kept in the top bits of the status
+         */
+        void setPriority (uint32_t level);
+
+        /**
+				 * Method: getPriority
+				 * Returns:
+				 * The priority of the codelet, higher runs first with the priority policies
+         */
+        uint32_t getPriority (void) const;
+
+        /**
+				 * Method: getLocality
+				 * Returns:
+				 * The status without the priority bits
+         */
+        uint32_t getLocality (void) const { return status_ & LOCALITY_MASK; }
+
 				/**
 				 * Method: getTP
 				 * Returns:
 				 * The parent ThreadedProcedure pointer
          */
-        ThreadedProcedure * getTP(void);
+        ThreadedProcedure * getTP(void) { return myTP_; }
 				
 				/**
 				 * Method: setTP
@@ -178,6 +232,13 @@ namespace darts
 				 * This is the code of the codelet to be executed.
          */
         virtual void fire(void) = 0;
+        
+        /**
+				 * Method: dispatch
+				 * Fires the codelet, what the schedulers call. A <CodeletT> is
+				 * fired through its direct entry, others through fire().
+         */
+        inline void dispatch(void);
 
 	virtual Fifo * getConsumer() { return(nullptr); }
 	virtual Fifo * getProducer() { return(nullptr); }
@@ -185,11 +246,73 @@ namespace darts
 	virtual void setConsumer(Fifo *consumer) { return; }
 	virtual void setProducer(Fifo *producer) { return; }
 	virtual void decDepConsumerCod() { return; }
-        virtual Fifo * generateFifo(const uint64_t cluster, const uint64_t localMem, const uint64_t id, const uint64_t size, Codelet *consumer) { return(nullptr); }
+	virtual uint64_t getNumConsumerCods() { return(0); }
+	virtual Codelet * getConsumerCodAt(uint64_t) { return(nullptr); }
+	virtual uint64_t getNumProducerCods() { return(1); }
+	virtual Fifo * claimProducer(Fifo *) { return(nullptr); }
+	virtual void setInputLane(uint64_t) { return; }
+	virtual void setOutputLane(uint64_t) { return; }
+        virtual Fifo * generateFifo(const uint64_t cluster, const uint64_t localMem, const uint64_t id, const uint64_t size, Codelet *consumer, FifoPool *pool = nullptr) { return(nullptr); }
                  
         #ifdef TRACE
         void * returnFunct(void);
         #endif
     };    
 
+    //What dispatch finds behind a sealed codelet
+    class sealedCodelet : public Codelet
+    {
+    protected:
+        codeletFire fire_;
+        
+        sealedCodelet(uint32_t dep, uint32_t res, ThreadedProcedure * theTp, uint32_t stat, codeletFire fn):
+        Codelet(dep, res, theTp, stat),
+        fire_(fn)
+        {
+            setSealed();
+        }
+        
+        friend class Codelet;
+    };
+    
+    /*
+     * Class: CodeletT
+     * Sealed codelet, fired by the schedulers through a function pointer
+     * instead of the vtable:
+     * class myCodelet final : public CodeletT<myCodelet> { void fire(void); };
+     * Derived has to be final, so no class below it can override the fire
+     * the pointer calls, and the compiler calls (and may inline) that fire
+     * directly. Only sealed codelets carry the pointer, other codelets do
+     * not grow. It still is a Codelet everywhere else.
+     */
+    template<class Derived>
+    class CodeletT : public sealedCodelet
+    {
+    private:
+        static void
+        fireDirect(Codelet * codelet)
+        {
+            static_assert(__is_final(Derived), "a CodeletT has to be final");
+            static_cast<Derived*>(codelet)->fire();
+        }
+        
+    public:
+        CodeletT(uint32_t dep, uint32_t res, ThreadedProcedure * theTp=NULL, uint32_t stat=SHORTWAIT):
+        sealedCodelet(dep, res, theTp, stat, &fireDirect)
+        { }
+        
+        CodeletT(void):
+        sealedCodelet(0U, 0U, NULL, NIL, &fireDirect)
+        { }
+    };
+    
+    inline void
+    Codelet::dispatch(void)
+    {
+        if(kind_ & CODELET_SEALED)
+            static_cast<sealedCodelet*>(this)->fire_(this);
+        else
+            fire();
+    }
+
 } // namespace darts
@@ -0,0 +1,656 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PIPELINE_H
+#define	PIPELINE_H
+#include <stdint.h>
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Atomics.h"
+#include "getClock.h"
+#include "threadlocal.h"
+#include "TPScheduler.h"
+#include "ThreadedProcedure.h"
+#include "StreamingCodelet.h"
+#include "doTP.h"
+#include "Runtime.h"
+
+//Elements of input one pipeline Fifo lane is sized for, in bytes
+#define PIPE_EDGE_BYTES 65536
+#define PIPE_MIN_CAPACITY 64
+#define PIPE_MAX_CAPACITY 4096
+//Most elements a stage codelet handles per round
+#define PIPE_MAX_BATCH 64
+
+namespace darts
+{
+    template<typename T> class Pipeline;
+    
+    /*
+     * Per stage counters, summed over the replicas. busy is the time spent
+     * in fire, stall the time spent parked on an empty input or a full
+     * output, both in ns.
+     */
+    struct pipeStats
+    {
+        volatile uint64_t elements;
+        volatile uint64_t busy;
+        volatile uint64_t stall;
+        
+        pipeStats(void):
+        elements(0),
+        busy(0),
+        stall(0)
+        { }
+    };
+    
+    enum PIPESTAGE {PIPE_SOURCE = 0, PIPE_STAGE = 1, PIPE_SINK = 2};
+    
+    template<typename T>
+    struct pipeStage
+    {
+        PIPESTAGE kind;
+        std::string name;
+        std::function<bool(T&)> produce;
+        std::function<void(T&)> consume;
+        uint64_t replicas;
+        //Input edge, 0 lets the pipeline pick
+        uint64_t capacity;
+        uint64_t batch;
+        pipeStats stats;
+    };
+    
+    template<typename T> class pipeRun;
+    
+    /*
+     * One replica of a pipeline stage. Pops a batch from its input, runs
+     * the stage on it in place, pushes the survivors and parks on its
+     * Fifos when it cannot go on, so the state of the batch is kept in
+     * members. The edge functions are picked when the Fifos are wired,
+     * fire does not look at the Fifo variant.
+     */
+    template<typename T>
+    class pipeCodelet : public StreamingCodelet<T, T>
+    {
+    public:
+        typedef uint64_t (*pushEdge)(Fifo *, const T *, uint64_t);
+        typedef uint64_t (*popEdge)(Fifo *, T *, uint64_t, uint64_t);
+        
+    private:
+        pipeStage<T> * stage_;
+        Codelet * done_;
+        pushEdge push_;
+        popEdge pop_;
+        std::vector<T> buffer_;
+        uint64_t batch_;
+        uint64_t count_;
+        uint64_t sent_;
+        uint64_t elements_;
+        uint64_t parkedAt_;
+        bool ended_;
+        
+        template<class F>
+        static uint64_t
+        pushTo(Fifo * fifo, const T * buf, uint64_t n)
+        {
+            return static_cast<F*>(fifo)->pushN(buf, n);
+        }
+        
+        template<class F>
+        static uint64_t
+        popFrom(Fifo * fifo, T * buf, uint64_t max, uint64_t)
+        {
+            return static_cast<F*>(fifo)->popN(buf, max);
+        }
+        
+        static uint64_t
+        popLane(Fifo * fifo, T * buf, uint64_t max, uint64_t lane)
+        {
+            return static_cast<SPMCFifo<T>*>(fifo)->popN(buf, max, lane);
+        }
+        
+        //Adds what was done since start to the stage counters
+        void
+        account(uint64_t start, uint64_t now)
+        {
+            Atomics::fetchAdd(stage_->stats.busy, now - start);
+            Atomics::fetchAdd(stage_->stats.elements, elements_);
+            elements_ = 0;
+        }
+        
+        //True when we parked and have to return from fire right away
+        bool
+        park(bool input, uint64_t & start)
+        {
+            uint64_t now = getTime();
+            account(start, now);
+            parkedAt_ = now;
+            if((input) ? this->waitInput() : this->waitOutput())
+                return true;
+            parkedAt_ = 0;
+            start = getTime();
+            return false;
+        }
+        
+    public:
+        pipeCodelet(pipeStage<T> * stage, Codelet ** consumers, uint64_t numConsumers, Codelet * done):
+        StreamingCodelet<T, T>(0, 0, consumers, numConsumers, FANOUT_ROUNDROBIN),
+        stage_(stage),
+        done_(done),
+        push_(NULL),
+        pop_(NULL),
+        batch_(1),
+        count_(0),
+        sent_(0),
+        elements_(0),
+        parkedAt_(0),
+        ended_(false)
+        { }
+        
+        void
+        setBatch(uint64_t batch)
+        {
+            batch_ = batch;
+            buffer_.resize(batch);
+        }
+        
+        void
+        setOutputEdge(Fifo * fifo)
+        {
+            this->setConsumer(fifo);
+            this->setOutputLane(fifo->attachProducer());
+            if(dynamic_cast<SoftFifo<T>*>(fifo))
+                push_ = &pushTo< SoftFifo<T> >;
+            else if(dynamic_cast<SPMCFifo<T>*>(fifo))
+                push_ = &pushTo< SPMCFifo<T> >;
+            else if(dynamic_cast<MPSCFifo<T>*>(fifo))
+                push_ = &pushTo< MPSCFifo<T> >;
+            else
+                push_ = &pushTo< MPMCFifo<T> >;
+        }
+        
+        void
+        setInputEdge(Fifo * fifo, uint64_t lane)
+        {
+            this->setProducer(fifo);
+            this->setInputLane(lane);
+            if(dynamic_cast<SoftFifo<T>*>(fifo))
+                pop_ = &popFrom< SoftFifo<T> >;
+            else if(dynamic_cast<SPMCFifo<T>*>(fifo))
+                pop_ = &popLane;
+            else if(dynamic_cast<MPSCFifo<T>*>(fifo))
+                pop_ = &popFrom< MPSCFifo<T> >;
+            else
+                pop_ = &popFrom< MPMCFifo<T> >;
+        }
+        
+        virtual void
+        fire(void)
+        {
+            uint64_t start = getTime();
+            if(parkedAt_)
+            {
+                Atomics::fetchAdd(stage_->stats.stall, start - parkedAt_);
+                parkedAt_ = 0;
+            }
+            Fifo * in = this->getProducer();
+            Fifo * out = this->getConsumer();
+            T * buf = buffer_.data();
+            while(true)
+            {
+                if(sent_ < count_)
+                {
+                    sent_ += push_(out, buf + sent_, count_ - sent_);
+                    if(sent_ < count_)
+                    {
+                        if(park(false, start))
+                            return;
+                        continue;
+                    }
+                }
+                if(stage_->kind == PIPE_SOURCE)
+                {
+                    if(ended_)
+                        break;
+                    count_ = sent_ = 0;
+                    while(count_ < batch_ && !ended_)
+                    {
+                        if(stage_->produce(buf[count_]))
+                            count_++;
+                        else
+                            ended_ = true;
+                    }
+                    elements_ += count_;
+                    continue;
+                }
+                //Everything pushed before the input closed is visible once we see it closed
+                bool closed = in->closed();
+                uint64_t got = pop_(in, buf, batch_, this->inputLane());
+                if(!got)
+                {
+                    if(closed)
+                        break;
+                    if(park(true, start))
+                        return;
+                    continue;
+                }
+                elements_ += got;
+                if(stage_->kind == PIPE_SINK)
+                {
+                    for(uint64_t i = 0; i < got; i++)
+                        stage_->consume(buf[i]);
+                    continue;
+                }
+                //Compacts the elements the stage keeps to the front of the batch
+                uint64_t kept = 0;
+                for(uint64_t i = 0; i < got; i++)
+                {
+                    if(stage_->produce(buf[i]))
+                    {
+                        if(kept != i)
+                            buf[kept] = std::move(buf[i]);
+                        kept++;
+                    }
+                }
+                count_ = kept;
+                sent_ = 0;
+            }
+            account(start, getTime());
+            //The run may be torn down from here on, and our Fifos reused
+            if(in)
+                this->disassocProdFifo();
+            if(out)
+                this->disassocConsFifo();
+            else
+                done_->decDep();
+        }
+    };
+    
+    /*
+     * The codelets of one Pipeline::run. The stages are cut in segments of
+     * adjacent stages, each segment is a TP placed on one cluster, and the
+     * last segment TP to go deletes the run. The Fifos belong to the pool
+     * of the TP scheduler that built the run, which takes each of them back
+     * once both of its sides are done, for the next run to reuse.
+     */
+    template<typename T>
+    class pipeRun
+    {
+    public:
+        std::vector< pipeCodelet<T>* > codelets;
+        //First codelet of each stage in codelets, one past the end last
+        std::vector<size_t> firsts;
+        //First stage of each segment, one past the end last
+        std::vector<size_t> segments;
+        //Consumer codelets of each stage, the fan-out arrays of the stage before
+        std::vector< std::vector<Codelet*> > consumers;
+        std::atomic<size_t> live;
+        
+        pipeRun(void):
+        live(0)
+        { }
+        
+        ~pipeRun(void)
+        {
+            for(size_t i = 0; i < codelets.size(); i++)
+                delete codelets[i];
+        }
+    };
+    
+    template<typename T>
+    class pipeSegmentTP : public ThreadedProcedure
+    {
+    private:
+        pipeRun<T> * run_;
+        
+    public:
+        pipeSegmentTP(pipeRun<T> * run, size_t segment):
+        ThreadedProcedure(),
+        run_(run)
+        {
+            size_t first = run->firsts[run->segments[segment]];
+            size_t last = run->firsts[run->segments[segment + 1]];
+            for(size_t i = first; i < last; i++)
+            {
+                run->codelets[i]->setTP(this);
+                add(run->codelets[i]);
+            }
+        }
+        
+        ~pipeSegmentTP(void)
+        {
+            if(run_->live.fetch_sub(1) == 1)
+                delete run_;
+        }
+    };
+    
+    template<typename T>
+    class pipelineTP : public ThreadedProcedure
+    {
+    private:
+        class doneCD : public Codelet
+        {
+        private:
+            Codelet * toSignal_;
+            
+        public:
+            doneCD(ThreadedProcedure * myTP, Codelet * toSig):
+            Codelet(1, 1, myTP, LONGWAIT),
+            toSignal_(toSig)
+            { }
+            
+            virtual void
+            fire(void)
+            {
+                toSignal_->decDep();
+            }
+        };
+        
+        doneCD done_;
+        
+    public:
+        pipelineTP(Pipeline<T> * pipe, Codelet * toSig):
+        ThreadedProcedure(),
+        done_(this, toSig)
+        {
+            pipeRun<T> * run = pipe->build(&done_);
+            run->live.store(run->segments.size() - 1);
+            for(size_t i = 0; i + 1 < run->segments.size(); i++)
+                place< pipeSegmentTP<T> >(i, this, run, i);
+        }
+    };
+    
+    /*
+     * Class: Pipeline
+     * Builds a linear streaming pipeline out of functions, e.g.
+     * 
+     * Pipeline<record>().source(read).stage(parse, 4).stage(count).sink(write)
+     * 
+     * The source returns false at the end of the stream, a stage works on
+     * the element in place and returns false to drop it. Each stage runs
+     * as replicas StreamingCodelets, the replicas of a stage share its
+     * function and may call it concurrently. The pipeline wires the edges
+     * with the Fifo variant the replica counts call for, sizes each edge
+     * from sizeof(T) unless tune says otherwise, and places runs of
+     * adjacent stages that fit in one cluster on the same TP scheduler so
+     * their Fifos stay in a shared cache. T is copied through the Fifos
+     * as raw memory, so it has to be trivially copyable (a record or a
+     * pointer to one).
+     */
+    template<typename T>
+    class Pipeline
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Pipeline elements are copied through the Fifos as raw memory");
+    private:
+        std::vector< pipeStage<T> > stages_;
+        uint64_t wall_;
+        
+        Pipeline &
+        append(PIPESTAGE kind, const std::string & name, uint64_t replicas)
+        {
+            stages_.push_back(pipeStage<T>());
+            pipeStage<T> & stage = stages_.back();
+            stage.kind = kind;
+            stage.name = name;
+            stage.replicas = (replicas) ? replicas : 1;
+            stage.capacity = 0;
+            stage.batch = 0;
+            return *this;
+        }
+        
+        static uint64_t
+        roundPow2(uint64_t n)
+        {
+            uint64_t pow2 = 1;
+            while(pow2 < n)
+                pow2 <<= 1;
+            return pow2;
+        }
+        
+    public:
+        Pipeline(void):
+        wall_(0)
+        { }
+        
+        Pipeline &
+        source(std::function<bool(T&)> produce, const std::string & name = "source")
+        {
+            append(PIPE_SOURCE, name, 1);
+            stages_.back().produce = produce;
+            return *this;
+        }
+        
+        Pipeline &
+        stage(std::function<bool(T&)> work, uint64_t replicas = 1, const std::string & name = "stage")
+        {
+            append(PIPE_STAGE, name, replicas);
+            stages_.back().produce = work;
+            return *this;
+        }
+        
+        Pipeline &
+        sink(std::function<void(T&)> consume, const std::string & name = "sink")
+        {
+            append(PIPE_SINK, name, 1);
+            stages_.back().consume = consume;
+            return *this;
+        }
+        
+        /*
+         * Method: tune
+         * Overrides the capacity of the Fifo lanes feeding the last stage
+         * added and the number of elements its replicas handle per round
+         * (0 keeps the default). The source's batch is its output batch.
+         */
+        Pipeline &
+        tune(uint64_t capacity, uint64_t batch = 0)
+        {
+            if(!stages_.empty())
+            {
+                stages_.back().capacity = capacity;
+                stages_.back().batch = batch;
+            }
+            return *this;
+        }
+        
+        //A source, any number of stages and a sink, in that order
+        bool
+        valid(void) const
+        {
+            if(stages_.size() < 2 || stages_.front().kind != PIPE_SOURCE || stages_.back().kind != PIPE_SINK)
+                return false;
+            for(size_t i = 1; i + 1 < stages_.size(); i++)
+            {
+                if(stages_[i].kind != PIPE_STAGE)
+                    return false;
+            }
+            return true;
+        }
+        
+        /*
+         * Method: run
+         * Streams the source to the sink on rt and returns once the sink
+         * saw the end of the stream. Returns false, doing nothing, when the
+         * pipeline is not valid.
+         */
+        bool
+        run(Runtime * rt)
+        {
+            if(!valid())
+                return false;
+            for(size_t i = 0; i < stages_.size(); i++)
+                stages_[i].stats = pipeStats();
+            uint64_t start = getTime();
+            rt->run(launch< pipelineTP<T> >(this, &Runtime::finalSignal));
+            wall_ = getTime() - start;
+            return true;
+        }
+        
+        /*
+         * Method: build
+         * Makes the codelets and Fifos of one run, done is signaled by
+         * the sink. Called by the pipeline's root TP on a worker.
+         */
+        pipeRun<T> *
+        build(Codelet * done)
+        {
+            pipeRun<T> * run = new pipeRun<T>();
+            size_t numStages = stages_.size();
+            
+            //Segments of adjacent stages whose replicas fit in one cluster
+            uint64_t width = myThread.threadTPsched->getNumSub();
+            if(!width)
+                width = 1;
+            std::vector<size_t> segmentOf(numStages);
+            uint64_t load = 0;
+            for(size_t s = 0; s < numStages; s++)
+            {
+                if(s == 0 || load + stages_[s].replicas > width)
+                {
+                    run->segments.push_back(s);
+                    load = 0;
+                }
+                load += stages_[s].replicas;
+                segmentOf[s] = run->segments.size() - 1;
+            }
+            run->segments.push_back(numStages);
+            
+            //Codelets are built from the sink back so each stage knows its consumers
+            run->consumers.resize(numStages + 1);
+            std::vector< std::vector< pipeCodelet<T>* > > replicas(numStages);
+            for(size_t s = numStages; s-- > 0; )
+            {
+                std::vector<Codelet*> & next = run->consumers[s + 1];
+                for(uint64_t r = 0; r < stages_[s].replicas; r++)
+                {
+                    pipeCodelet<T> * cod = new pipeCodelet<T>(&stages_[s], (next.empty()) ? NULL : next.data(), next.size(), done);
+                    cod->setNumProducerCods((s) ? stages_[s - 1].replicas : 0);
+                    replicas[s].push_back(cod);
+                    run->consumers[s].push_back(cod);
+                }
+            }
+            run->firsts.resize(numStages + 1);
+            for(size_t s = 0; s < numStages; s++)
+            {
+                run->firsts[s] = run->codelets.size();
+                run->codelets.insert(run->codelets.end(), replicas[s].begin(), replicas[s].end());
+            }
+            run->firsts[numStages] = run->codelets.size();
+            
+            //Edges: the producers of stage s - 1 into the replicas of stage s
+            for(size_t s = 1; s < numStages; s++)
+            {
+                pipeStage<T> & stage = stages_[s];
+                uint64_t capacity = stage.capacity;
+                if(!capacity)
+                {
+                    capacity = PIPE_EDGE_BYTES / sizeof(T);
+                    capacity = (capacity < PIPE_MIN_CAPACITY) ? PIPE_MIN_CAPACITY : (capacity > PIPE_MAX_CAPACITY) ? PIPE_MAX_CAPACITY : capacity;
+                }
+                capacity = roundPow2(capacity);
+                uint64_t numCons = stage.replicas;
+                uint64_t numProds = stages_[s - 1].replicas;
+                //One lane per consumer on a fan-out, the shared variants get the room of all the lanes
+                uint64_t size = (numProds > 1) ? capacity * numCons : capacity;
+                pipeCodelet<T> * first = replicas[s - 1][0];
+                Fifo * fifo = first->generateFifo(segmentOf[s], 0, s, size, replicas[s][0], myThread.threadTPsched->getFifoPool());
+                for(uint64_t p = 0; p < numProds; p++)
+                    replicas[s - 1][p]->setOutputEdge(fifo);
+                for(uint64_t c = 0; c < numCons; c++)
+                    replicas[s][c]->setInputEdge(fifo, c);
+                //A consumer wakes up every batch, the watermark is a quarter of a lane at most
+                uint64_t batch = stage.batch;
+                if(!batch)
+                    batch = (capacity / 4 < PIPE_MAX_BATCH) ? capacity / 4 : PIPE_MAX_BATCH;
+                fifo->setWatermark(batch);
+                for(uint64_t c = 0; c < numCons; c++)
+                    replicas[s][c]->setBatch(batch);
+                if(s == 1)
+                    first->setBatch((stages_[0].batch) ? stages_[0].batch : batch);
+            }
+            return run;
+        }
+        
+        size_t
+        getNumStages(void) const
+        {
+            return stages_.size();
+        }
+        
+        const pipeStats &
+        getStats(size_t stage) const
+        {
+            return stages_[stage].stats;
+        }
+        
+        //Wall clock time of the last run, in ns
+        uint64_t
+        getWallTime(void) const
+        {
+            return wall_;
+        }
+        
+        /*
+         * Method: report
+         * One line per stage of the last run: elements, time in fire and
+         * parked, cost per element and throughput. The stage with the most
+         * busy time per replica is marked as the bottleneck.
+         */
+        void
+        report(std::ostream & out = std::cout) const
+        {
+            size_t slowest = 0;
+            for(size_t i = 1; i < stages_.size(); i++)
+            {
+                if(stages_[i].stats.busy / stages_[i].replicas > stages_[slowest].stats.busy / stages_[slowest].replicas)
+                    slowest = i;
+            }
+            double seconds = (wall_) ? wall_ / 1e9 : 1.0;
+            for(size_t i = 0; i < stages_.size(); i++)
+            {
+                const pipeStage<T> & stage = stages_[i];
+                uint64_t elements = stage.stats.elements;
+                out << std::left << std::setw(12) << stage.name << std::right
+                    << " x" << stage.replicas
+                    << " elements: " << elements
+                    << " busy: " << stage.stats.busy / 1000000 << " ms"
+                    << " stall: " << stage.stats.stall / 1000000 << " ms"
+                    << " cost: " << ((elements) ? stage.stats.busy / elements : 0) << " ns/elem"
+                    << " throughput: " << std::fixed << std::setprecision(2) << elements / seconds / 1e6 << " Melem/s"
+                    << ((i == slowest) ? " <- bottleneck" : "") << std::endl;
+            }
+        }
+    };
+}
+
+#endif	/* PIPELINE_H */
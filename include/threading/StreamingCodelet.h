@@ -1,39 +1,142 @@
 #pragma once
 #include <stdint.h>
 #include "Codelet.h"
+#include "ThreadedProcedure.h"
+#include "Atomics.h"
+#include "Fifo.h"
 namespace darts
 {
 
     template <typename inputData, typename outputData>
     class StreamingCodelet : public Codelet {
     protected:
-	    Fifo *producer_; //assigned by TP scheduler when dependencies fulfilled
+	    Fifo *producer_; //assigned by TP scheduler when dependencies fulfilled, read with loadAcquire
 	    Fifo *consumer_; //same here. These can both be active
 	Codelet * consumerCod_; //pipelining chain goes downwards so only contains consumer Codelet pointer
 	//think of it like a linked list of streaming codelets managed by the SU
+	Codelet ** consumerCods_; //fan-out: numConsumerCods_ consumers instead of consumerCod_
+	uint64_t numConsumerCods_;
+	FANOUT fanOut_;
+	uint64_t numProducerCods_; //fan-in: how many producers push to our input Fifo
+	uint64_t inLane_; //our lane in the input (output) Fifo, set when the Fifo is wired
+	uint64_t outLane_;
 	virtual bool isStreaming() { return true; }
+	void holdTP() {
+	    if (getTP())
+	        getTP()->incRef();
+	}
+	// the current firing still holds its own reference, so this cannot drop the last one
+	bool releaseTP(bool parked) {
+	    if (!parked && getTP())
+	        getTP()->decRef();
+	    return(parked);
+	}
+	// a recycled Fifo of type F from pool, a new one (that pool adopts) when there is none
+	template <class F, class... Extra>
+	F * makeFifo(FifoPool *pool, const uint64_t cluster, const uint64_t localMem, const uint64_t id, const uint64_t size, Codelet *consumer,
+	             uint64_t numProds, uint64_t numCons, Extra... extra) {
+	    if (pool) {
+	        Fifo * reused = pool->reuse(typeid(F), sizeof(outputData), size, numProds, numCons);
+	        if (reused) {
+	            reused->recycle(cluster, localMem, id, this, consumer);
+	            return(static_cast<F *>(reused));
+	        }
+	    }
+	    F * fresh = new F(cluster, localMem, id, size, this, consumer, extra...);
+	    if (pool)
+	        pool->adopt(fresh);
+	    return(fresh);
+	}
     public:
         StreamingCodelet() :
-	    Codelet()
-	    { };
+	    Codelet(),
+	    producer_(nullptr),
+	    consumer_(nullptr),
+	    consumerCod_(nullptr),
+	    consumerCods_(nullptr),
+	    numConsumerCods_(0),
+	    fanOut_(FANOUT_ROUNDROBIN),
+	    numProducerCods_(1),
+	    inLane_(0),
+	    outLane_(0)
+	    { setStreaming(); };
         StreamingCodelet(Codelet *consumerCod) :
 	    Codelet(),
-	    consumerCod_(consumerCod)
-	    { };
+	    producer_(nullptr),
+	    consumer_(nullptr),
+	    consumerCod_(consumerCod),
+	    consumerCods_(nullptr),
+	    numConsumerCods_((consumerCod) ? 1 : 0),
+	    fanOut_(FANOUT_ROUNDROBIN),
+	    numProducerCods_(1),
+	    inLane_(0),
+	    outLane_(0)
+	    { setStreaming(); };
         StreamingCodelet(uint32_t dep, uint32_t res, Codelet *consumerCod, ThreadedProcedure * theTp=NULL, uint32_t stat=SHORTWAIT) :
 	    Codelet(dep, res, theTp, stat),
-	    consumerCod_(consumerCod)
-	    { };
+	    producer_(nullptr),
+	    consumer_(nullptr),
+	    consumerCod_(consumerCod),
+	    consumerCods_(nullptr),
+	    numConsumerCods_((consumerCod) ? 1 : 0),
+	    fanOut_(FANOUT_ROUNDROBIN),
+	    numProducerCods_(1),
+	    inLane_(0),
+	    outLane_(0)
+	    { setStreaming(); };
+	// fan-out to numConsumerCods codelets, the array is read when the Fifo is wired and must live until then
+        StreamingCodelet(uint32_t dep, uint32_t res, Codelet **consumerCods, uint64_t numConsumerCods, FANOUT fanOut, ThreadedProcedure * theTp=NULL, uint32_t stat=SHORTWAIT) :
+	    Codelet(dep, res, theTp, stat),
+	    producer_(nullptr),
+	    consumer_(nullptr),
+	    consumerCod_(nullptr),
+	    consumerCods_(consumerCods),
+	    numConsumerCods_(numConsumerCods),
+	    fanOut_(fanOut),
+	    numProducerCods_(1),
+	    inLane_(0),
+	    outLane_(0)
+	    { setStreaming(); };
 	Fifo * getConsumer() { return(consumer_); } //maybe get rid of these
-	Fifo * getProducer() { return(producer_); } // and replace with just pop/push
-	void setProducer(Fifo *producer) { this->producer_ = producer; }
+	Fifo * getProducer() { return(Atomics::loadAcquire(producer_)); } // and replace with just pop/push
+	void setProducer(Fifo *producer) { Atomics::storeRelease(producer_, producer); }
 	void setConsumer(Fifo *consumer) { this->consumer_ = consumer; }
-	Codelet * getConsumerCod() { return(consumerCod_); }
-	void setConsumerCod(Codelet *consumerCod) { this->consumerCod_ = consumerCod; }
-	virtual void decDepConsumerCod() { (this->consumerCod_)->decDep(); }
-        virtual Fifo * generateFifo(const uint64_t cluster, const uint64_t localMem, const uint64_t id, const uint64_t size, Codelet *consumer) {
+	Codelet * getConsumerCod() { return((consumerCods_ && numConsumerCods_) ? consumerCods_[0] : consumerCod_); }
+	void setConsumerCod(Codelet *consumerCod) { 
+	    this->consumerCod_ = consumerCod;
+	    this->consumerCods_ = nullptr;
+	    this->numConsumerCods_ = (consumerCod) ? 1 : 0;
+	}
+	uint64_t getNumConsumerCods() { return(numConsumerCods_); }
+	Codelet * getConsumerCodAt(uint64_t i) { return((consumerCods_) ? consumerCods_[i] : consumerCod_); }
+	// fan-in: set on the consumer before it is wired when several producers push to it
+	void setNumProducerCods(uint64_t num) { this->numProducerCods_ = num; }
+	uint64_t getNumProducerCods() { return(numProducerCods_); }
+	// the first producer wired sets our input Fifo, the others get it back and share it
+	Fifo * claimProducer(Fifo *producer) { return(Atomics::compareAndSwap(producer_, (Fifo *) nullptr, producer)); }
+	void setInputLane(uint64_t lane) { this->inLane_ = lane; }
+	void setOutputLane(uint64_t lane) { this->outLane_ = lane; }
+	uint64_t inputLane() const { return(inLane_); }
+	uint64_t outputLane() const { return(outLane_); }
+	virtual void decDepConsumerCod() { 
+	    for (uint64_t i = 0; i < numConsumerCods_; i++)
+	        getConsumerCodAt(i)->decDep();
+	}
+	// picks the Fifo variant from the number of producers and consumers on the edge,
+	// taking it from pool when one of the same shape was handed back there
+        virtual Fifo * generateFifo(const uint64_t cluster, const uint64_t localMem, const uint64_t id, const uint64_t size, Codelet *consumer, FifoPool *pool = nullptr) {
 		//Fifo * streamFifo = new MsgQFifo<outputData>(0, 0, 0, 10, this, this->getConsumerCod()); 
-		Fifo * streamFifo = new SoftFifo<outputData>(0, 0, 0, 50, this, this->getConsumerCod()); 
+		uint64_t numProds = consumer->getNumProducerCods();
+		if (numProds > 1 && numConsumerCods_ > 1)
+		    return(makeFifo< MPMCFifo<outputData> >(pool, cluster, localMem, id, size, consumer, numProds, numConsumerCods_, numProds, numConsumerCods_));
+		if (numProds > 1)
+		    return(makeFifo< MPSCFifo<outputData> >(pool, cluster, localMem, id, size, consumer, numProds, 1, numProds, (uint64_t) 1));
+		if (numConsumerCods_ > 1) {
+		    SPMCFifo<outputData> * fanOut = makeFifo< SPMCFifo<outputData> >(pool, cluster, localMem, id, size, consumer, 1, numConsumerCods_, numConsumerCods_, fanOut_);
+		    fanOut->setMode(fanOut_);
+		    return(fanOut);
+		}
+		Fifo * streamFifo = makeFifo< SoftFifo<outputData> >(pool, cluster, localMem, id, size, consumer, 1, 1); 
 	    return(streamFifo);
 	}
 	// this StreamingCodelet is done pushing to consumer Fifo
@@ -46,6 +149,18 @@ namespace darts
             //disassociates this Codelet from the producer Fifo by setting Fifo's consumer to nullptr
 	    getProducer()->disassocCons();
 	}
+	/* Cooperative streaming: instead of spinning, a consumer that finds
+	 * its input empty (a producer that finds its output full) calls these
+	 * and returns from fire when they return true. The codelet is fired
+	 * again once the other side made progress, so its position in the
+	 * stream has to be kept in members rather than in locals of fire.
+	 * disassocConsFifo wakes up a parked consumer for the end of stream.
+	 * A parked codelet holds a reference on its TP, so the TP outlives
+	 * codelets that are all parked; the firing that follows the wake up
+	 * takes that reference over.
+	 */
+	bool waitInput() { holdTP(); return(releaseTP(getProducer()->parkConsumer(this, inLane_))); }
+	bool waitOutput() { holdTP(); return(releaseTP(getConsumer()->parkProducer(this, outLane_))); }
 	/* The generateFifo method is only attached here as a way to resolve
 	 * the typing issue with template subclass(es) of Fifo and so the SU
 	 * (i.e. TPScheduler and TPSchedPolicy don't have to be aware of the
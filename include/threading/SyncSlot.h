@@ -31,6 +31,10 @@
 #include <iostream>
 #include <stdint.h>
 #include "Atomics.h"
+#include "SyncTree.h"
+
+//Default count from which a SyncSlot in SYNC_AUTO mode uses a tree
+#define SYNC_TREE_THRESHOLD 64U
 
 
 namespace darts
@@ -39,33 +43,88 @@ namespace darts
   /*
 	 * Class: SyncSlot
    * This class contains to ints which are used as a counter and reset. This is to allow
-   * a codelet to run.
+   * a codelet to run. Counts at or above the tree threshold are kept in a
+   * <SyncTree> so the signals of a high fan-in codelet stay within each cluster.
 	 * 
 	 * See Also:
 	 * <Atomics>
+	 * <SyncTree>
 	*/
   
+  enum syncMode
+  {
+    SYNC_AUTO, //tree when the count reaches the threshold
+    SYNC_FLAT, //always one counter
+    SYNC_TREE  //always a tree when there is more than one cluster
+  };
+  
   class SyncSlot
   {
   private:
     unsigned int counter_;
     unsigned int reset_;
+    syncMode mode_;
+    SyncTree * tree_;
+    
+    static unsigned int treeThreshold_;
+    static unsigned int treeLeaves_;
+    
+    //Picks the flat counter or the tree for the next count, in SYNC_AUTO
+    //a slot keeps its tree once it has one so loops do not reallocate it
+    void shape(uint32_t count);
+    bool treeDec(void);
+    void treeInc(void);
   public:
     SyncSlot(uint32_t dep, uint32_t res):
     counter_(dep),
-    reset_(res) { }
+    reset_(res),
+    mode_(SYNC_AUTO),
+    tree_(0)
+    {
+        shape(dep);
+    }
+    
+    SyncSlot(const SyncSlot & other):
+    counter_(other.getCounter()),
+    reset_(other.reset_),
+    mode_(other.mode_),
+    tree_(0)
+    {
+        shape(counter_);
+    }
+    
+    SyncSlot &
+    operator=(const SyncSlot & other)
+    {
+        if(this != &other)
+        {
+            counter_ = other.getCounter();
+            reset_ = other.reset_;
+            mode_ = other.mode_;
+            shape(counter_);
+        }
+        return *this;
+    }
+    
+    ~SyncSlot(void)
+    {
+        delete tree_;
+    }
     
     void
     initSyncSlot(uint32_t dep, uint32_t res)
     {
         counter_ = dep;
         reset_ = res;
+        shape(dep);
     }
     
     //dec the counter
     bool 
     decCounter(void)
     {
+        if(tree_)
+            return treeDec();
         return (1==Atomics::fetchSub(counter_, 1U));
     }
     
@@ -73,7 +132,10 @@ namespace darts
     void
     incCounter(void)
     {
-      Atomics::fetchAdd(counter_, 1U);
+      if(tree_)
+        treeInc();
+      else
+        Atomics::fetchAdd(counter_, 1U);
       Atomics::fetchAdd(reset_, 1U);
     }
     
@@ -82,17 +144,58 @@ namespace darts
     resetCounter(void)
     {
         counter_ = reset_;
+        shape(reset_);
         //return Atomics::boolcompareAndSwap(counter_,0U,reset_);
     }
     
+    //the value resetCounter puts back
+    uint32_t getReset(void) const{
+        return reset_;
+    }
+    
     uint32_t getCounter(void) const{
+        if(tree_)
+            return tree_->getCounter();
         return counter_;
     }
     
     //returns the if the counter has reached zero
     bool ready(void) const{
+        if(tree_)
+            return tree_->ready();
         return (counter_ == 0);
-    }  
+    }
+    
+    /*
+     * Method: setMode
+     * Forces the flat counter or the tree, takes effect on the next
+     * init or reset
+     */
+    void
+    setMode(syncMode mode)
+    {
+        mode_ = mode;
+    }
+    
+    syncMode getMode(void) const{
+        return mode_;
+    }
+    
+    bool isTree(void) const{
+        return (tree_ != 0);
+    }
+    
+    /*
+     * Method: setTreeThreshold
+     * Counts at or above threshold use a tree in SYNC_AUTO mode, 0 turns
+     * the trees off
+     */
+    static void setTreeThreshold(unsigned int threshold) { treeThreshold_ = threshold; }
+    static unsigned int getTreeThreshold(void) { return treeThreshold_; }
+    
+    //One leaf per cluster, set by the runtime
+    static void setTreeLeaves(unsigned int leaves) { treeLeaves_ = leaves; }
+    static unsigned int getTreeLeaves(void) { return treeLeaves_; }
   };
 
 } // namespace darts
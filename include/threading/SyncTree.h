@@ -0,0 +1,144 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include <stdint.h>
+#include "Atomics.h"
+
+namespace darts
+{
+
+  /*
+   * Class: SyncTree
+   * Dependence counter split over one leaf per cluster. A decrement goes to
+   * the caller's leaf, or to the next leaf with a count left once its own
+   * is spent, and the leaf taken to zero decrements the root. The root
+   * counts the leaves that still have a count, so the decrement that takes
+   * it to zero is the last one.
+   *
+   * See Also:
+   * <SyncSlot>
+   */
+  class SyncTree
+  {
+  private:
+    struct leaf
+    {
+        unsigned int count;
+        char pad[64-sizeof(unsigned int)];
+    };
+    
+    unsigned int root_;
+    char pad_[64-sizeof(unsigned int)];
+    unsigned int numLeaves_;
+    leaf * leaves_;
+    
+    SyncTree(const SyncTree &);
+    SyncTree & operator=(const SyncTree &);
+  public:
+    SyncTree(unsigned int numLeaves, unsigned int count):
+    numLeaves_(numLeaves),
+    leaves_(new leaf[numLeaves])
+    {
+        arm(count);
+    }
+    
+    ~SyncTree(void)
+    {
+        delete [] leaves_;
+    }
+    
+    //Spreads count over the leaves, no decrement may run at the same time
+    void
+    arm(unsigned int count)
+    {
+        unsigned int base = count / numLeaves_;
+        unsigned int extra = count % numLeaves_;
+        root_ = 0;
+        for(unsigned int i = 0; i < numLeaves_; i++)
+        {
+            leaves_[i].count = base + ((i < extra) ? 1U : 0U);
+            if(leaves_[i].count)
+                root_++;
+        }
+    }
+    
+    //Returns true for the decrement that takes the whole count to zero
+    bool
+    decCounter(unsigned int home)
+    {
+        for(unsigned int k = 0; k < numLeaves_; k++)
+        {
+            leaf & node = leaves_[(home + k) % numLeaves_];
+            unsigned int val = node.count;
+            while(val)
+            {
+                if(Atomics::boolcompareAndSwap(node.count, val, val - 1U))
+                    return (val == 1U) && (1U == Atomics::fetchSub(root_, 1U));
+                val = node.count;
+            }
+        }
+        return false;
+    }
+    
+    void
+    incCounter(unsigned int home)
+    {
+        //Hold the root up while the leaf may go from zero to one
+        Atomics::fetchAdd(root_, 1U);
+        leaf & node = leaves_[home % numLeaves_];
+        unsigned int val = node.count;
+        while(!Atomics::boolcompareAndSwap(node.count, val, val + 1U))
+            val = node.count;
+        //The leaf was already counted by the root
+        if(val)
+            Atomics::fetchSub(root_, 1U);
+    }
+    
+    uint32_t
+    getCounter(void) const
+    {
+        uint32_t sum = 0;
+        for(unsigned int i = 0; i < numLeaves_; i++)
+            sum += leaves_[i].count;
+        return sum;
+    }
+    
+    unsigned int
+    getNumLeaves(void) const
+    {
+        return numLeaves_;
+    }
+    
+    bool
+    ready(void) const
+    {
+        return (root_ == 0);
+    }
+  };
+
+} // namespace darts
@@ -44,6 +44,10 @@ namespace darts
 	 * ref_ says when the TP is done
 	*/
         unsigned int ref_;
+        //Index plus one of the TP in the taskGraph capturing it, 0 when none
+        unsigned int node_;
+        static bool deferRefs_;
+        friend class taskGraph;
     public:
         ThreadedProcedure * parentTP_;
         ThreadedProcedure(void);
@@ -53,8 +57,29 @@ namespace darts
         
         bool decRef (void);
         void incRef (void);
+        /*
+         * Method: deferDecRef
+         * Drops a reference like decRef but keeps it in the worker until it
+         * moves to another TP or goes idle, so the workers firing the
+         * codelets of one TP do not all hit ref_. The TP is deleted by
+         * whoever folds the last reference.
+         */
+        void deferDecRef (void);
+        /*
+         * Method: setDeferRefs
+         * Turns deferDecRef into a plain decRef when false, only to be
+         * changed between runs. Used to measure what deferring saves.
+         */
+        static void setDeferRefs (bool defer);
+        /*
+         * Method: foldRefs
+         * Folds the references the calling worker deferred, called when the
+         * worker runs out of work or stops
+         */
+        static void foldRefs (void);
         bool zeroRef (void);
-        bool checkParent(void);
+        //False for root TPs and serial loops, whose codelets do not drop references
+        bool checkParent(void) { return parentTP_ && parentTP_ != this; }
         /*
         * Method: addCodelet
         * Adds a codelet to the TP's list
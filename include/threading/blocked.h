@@ -0,0 +1,313 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef BLOCKED_H
+#define	BLOCKED_H
+#include <stdint.h>
+#include "loop.h"
+
+namespace darts
+{
+    /*
+     * Class: blockRange
+     * A 2D or 3D box of iterations [lo,hi) per dimension with a grain per
+     * dimension. A box can be split while one of its dimensions is longer
+     * than its grain, splits are cut on multiples of the grain along the
+     * dimension that is the longest measured in grains. Unused dimensions
+     * are [0,1) with a grain of 1 and never split.
+     */
+    class blockRange
+    {
+    public:
+        unsigned int lo[3];
+        unsigned int hi[3];
+        unsigned int grain[3];
+        
+        blockRange(void)
+        {
+            set(0, 0, 0, 1);
+            set(1, 0, 1, 1);
+            set(2, 0, 1, 1);
+        }
+        
+        blockRange(unsigned int rowStart, unsigned int rowEnd, unsigned int rowGrain,
+                   unsigned int colStart, unsigned int colEnd, unsigned int colGrain)
+        {
+            set(0, rowStart, rowEnd, rowGrain);
+            set(1, colStart, colEnd, colGrain);
+            set(2, 0, 1, 1);
+        }
+        
+        blockRange(unsigned int rowStart, unsigned int rowEnd, unsigned int rowGrain,
+                   unsigned int colStart, unsigned int colEnd, unsigned int colGrain,
+                   unsigned int pageStart, unsigned int pageEnd, unsigned int pageGrain)
+        {
+            set(0, rowStart, rowEnd, rowGrain);
+            set(1, colStart, colEnd, colGrain);
+            set(2, pageStart, pageEnd, pageGrain);
+        }
+        
+        unsigned int begin(unsigned int dim) const { return lo[dim]; }
+        unsigned int end(unsigned int dim) const { return hi[dim]; }
+        unsigned int size(unsigned int dim) const { return (hi[dim] > lo[dim]) ? hi[dim] - lo[dim] : 0; }
+        
+        bool
+        empty(void) const
+        {
+            return !size(0) || !size(1) || !size(2);
+        }
+        
+        //The dimension to cut next, 3 if the box is down to its grain
+        unsigned int
+        longest(void) const
+        {
+            unsigned int best = 3;
+            for(unsigned int d = 0; d < 3; d++)
+            {
+                if(size(d) <= grain[d])
+                    continue;
+                if(best == 3 || (uint64_t) size(d) * grain[best] > (uint64_t) size(best) * grain[d])
+                    best = d;
+            }
+            return best;
+        }
+        
+        bool divisible(void) const { return longest() != 3; }
+        
+        //Keeps about num/den of the box and returns the rest
+        blockRange
+        split(unsigned int num, unsigned int den)
+        {
+            blockRange upper(*this);
+            unsigned int d = longest();
+            unsigned int units = size(d) / grain[d];
+            unsigned int cut = (unsigned int) (((uint64_t) units * num) / den);
+            if(!cut)
+                cut = 1;
+            hi[d] = lo[d] + cut * grain[d];
+            upper.lo[d] = hi[d];
+            return upper;
+        }
+        
+        //Number of boxes left once every box is split down to its grain
+        uint64_t
+        tiles(void) const
+        {
+            if(empty())
+                return 0;
+            if(!divisible())
+                return 1;
+            blockRange lower(*this);
+            blockRange upper = lower.split(1, 2);
+            return lower.tiles() + upper.tiles();
+        }
+        
+    private:
+        void
+        set(unsigned int dim, unsigned int start, unsigned int stop, unsigned int g)
+        {
+            lo[dim] = start;
+            hi[dim] = stop;
+            grain[dim] = (g) ? g : 1;
+        }
+    };
+    
+    /*
+     * Class: blockLoop
+     * Base of the loop TPs of a blockedFor. They are built with
+     * (range, toSig, args...) and signal toSig once every iteration of
+     * range is done.
+     */
+    class blockLoop : public ThreadedProcedure
+    {
+    public:
+        Codelet * toSignal;
+        blockRange range;
+        
+        blockLoop(const blockRange & Range, Codelet * toSig):
+        toSignal(toSig),
+        range(Range)
+        { }
+        
+        virtual ~blockLoop(void) {}
+    };
+    
+    //Builds the closure of the loop TP for one tile
+    struct blockClosure
+    {
+        virtual tpClosure * make(ThreadedProcedure * parent, const blockRange & range, Codelet * toSig) = 0;
+        virtual ~blockClosure(void) {}
+    };
+    
+    template< class LP, class... Args >
+    struct blockClosureArgs : blockClosure
+    {
+        std::tuple< Args... > args;
+        
+        template< class... Fwd >
+        blockClosureArgs(Fwd&&... fwd) :
+        args(std::forward< Fwd >(fwd)...)
+        { }
+        
+        template< size_t... I >
+        tpClosure *
+        makeClosure(ThreadedProcedure * parent, const blockRange & range, Codelet * toSig, indexList< I... >)
+        {
+            tpfactory funct = &TPFactory< LP, blockRange, Codelet*, Args... >;
+            return new tpClosureArgs< blockRange, Codelet*, Args... >(funct, parent, range, toSig, std::get< I >(args)...);
+        }
+        
+        virtual tpClosure *
+        make(ThreadedProcedure * parent, const blockRange & range, Codelet * toSig)
+        {
+            return makeClosure(parent, range, toSig, typename makeIndexList< sizeof...(Args) >::type());
+        }
+    };
+    
+    /*
+     * Class: blockedFor
+     * Loop codelet over a <blockRange> whose loop TPs (see <blockLoop>) each
+     * run one tile, a box split down to its grain. The box is first cut in
+     * one piece per cluster, neighbouring pieces going to neighbouring TP
+     * schedulers, then each piece is split in halves along its longest
+     * dimension by the cluster it went to, so the tiles run under one last
+     * level cache are neighbours in the box. toSig is signaled once every
+     * tile is done.
+     */
+    template<class LP>
+    class blockedFor : public Codelet
+    {
+    private:
+        class splitter : public ThreadedProcedure
+        {
+        public:
+            class cut : public Codelet
+            {
+            public:
+                cut(ThreadedProcedure * myTP):
+                Codelet(0,0,myTP,SHORTWAIT)
+                { }
+                
+                virtual void fire(void)
+                {
+                    splitter * mySplitter = static_cast<splitter*>(myTP_);
+                    blockedFor * owner = mySplitter->owner;
+                    blockRange range = mySplitter->range;
+                    //Keep the lower half and give the upper one away
+                    while(range.divisible())
+                    {
+                        blockRange upper = range.split(1, 2);
+                        invoke<splitter>(owner->myTP_, owner, upper);
+                    }
+                    owner->myTP_->incRef();
+                    myThread.threadTPsched->pushTP(owner->closure_->make(owner->myTP_, range, owner));
+                }
+            };
+            
+            blockedFor * owner;
+            blockRange range;
+            cut split;
+            
+            splitter(blockedFor * Owner, const blockRange & Range):
+            owner(Owner),
+            range(Range),
+            split(this)
+            {
+                add(&split);
+            }
+        };
+        
+        uint32_t Dep;
+        uint32_t Res;
+        uint32_t Stat;
+        bool fired;
+        blockRange range_;
+        Codelet * toSignal_;
+        blockClosure * closure_;
+        
+        //Cuts range in parts pieces for the TP schedulers first to first+parts
+        uint64_t
+        divide(blockRange range, unsigned int first, unsigned int parts, bool spawn)
+        {
+            if(parts > 1 && range.divisible())
+            {
+                unsigned int lower = parts / 2;
+                blockRange upper = range.split(lower, parts);
+                return divide(range, first, lower, spawn) + divide(upper, first + lower, parts - lower, spawn);
+            }
+            if(spawn)
+                place<splitter>(first, myTP_, this, range);
+            return range.tiles();
+        }
+        
+    public:
+        ~blockedFor(void)
+        {
+            delete closure_;
+        }
+        
+        void setRange(const blockRange & range) { range_=range;}
+        const blockRange & getRange(void) const { return range_; }
+        
+        template< class... Args >
+        blockedFor(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat, Codelet * toSig, const blockRange & range,
+        Args&&... args) :
+        Codelet(dep, res, myTP, stat),
+        Dep(dep),
+        Res(res),
+        Stat(stat),
+        fired(false),
+        range_(range),
+        toSignal_(toSig),
+        closure_(new blockClosureArgs< LP, typename std::decay<Args>::type... >(std::forward<Args>(args)...))
+        { }
+        
+        void fire(void)
+        {
+            fired=!fired;
+            //inverted
+            if(fired && !range_.empty())
+            {
+                unsigned int clusters = myThread.threadTPsched->getNumTPSched();
+                if(!clusters)
+                    clusters = 1;
+                uint64_t tiles = divide(range_, 0, clusters, false);
+                initCodelet((uint32_t) tiles,Res,myTP_,Stat);
+                divide(range_, 0, clusters, true);
+            }
+            else
+            {
+                fired = false;
+                initCodelet(Dep,Res,myTP_,Stat);
+                toSignal_->decDep();
+            }
+        }
+    };
+}
+
+#endif	/* BLOCKED_H */
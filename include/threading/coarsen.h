@@ -0,0 +1,183 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef COARSEN_H
+#define	COARSEN_H
+#include <stddef.h>
+#include "doTP.h"
+#include "slab.h"
+
+namespace darts
+{
+    /*
+     * Adaptive task coarsening. A TP that splits its work can ask saturated()
+     * before every invoke: when the TP scheduler of the calling worker already
+     * holds enough queued work and nobody around it is parked, a new TP would
+     * only wait in the queue, so the child is run right away on the calling
+     * worker instead. coarseInvoke builds the TP inline, skipping the trip
+     * through the ready queue, and the form taking a serial function calls it
+     * with the TP's constructor arguments and does not build a TP at all.
+     */
+
+    //Queued TPs and codelets a TP scheduler can hold before it is saturated,
+    //0 (the default) means twice the number of workers in its cluster
+    void setCoarsenDepth(size_t depth);
+    size_t getCoarsenDepth(void);
+
+    //True when the calling worker should run new children itself
+    bool saturated(void);
+
+    //Invokes newTP, or builds it on the calling worker when saturated
+    template<class newTP, class... Args>
+    void
+    coarseInvoke(ThreadedProcedure * parentTP, Args&&... args)
+    {
+        if(!saturated())
+        {
+            invoke<newTP>(parentTP, std::forward<Args>(args)...);
+            return;
+        }
+        parentTP->incRef();
+        tpClosure * closure = makeClosure<newTP>(parentTP, std::forward<Args>(args)...);
+        closure->factory(closure);
+        delete closure;
+    }
+
+    //Invokes newTP, or calls serial with the same arguments when saturated.
+    //serial has to signal what the TP would have signaled
+    template<class newTP, class Serial, class... Args>
+    void
+    coarseInvoke(Serial serial, ThreadedProcedure * parentTP, Args&&... args)
+    {
+        if(saturated())
+            serial(std::forward<Args>(args)...);
+        else
+            invoke<newTP>(parentTP, std::forward<Args>(args)...);
+    }
+
+    //Solves a problem of a divideConquer without the runtime
+    template<class Problem>
+    void
+    dcRecurse(Problem & problem)
+    {
+        if(problem.leaf())
+        {
+            problem.solve();
+            return;
+        }
+        Problem parts[Problem::arity];
+        problem.split(parts);
+        for(unsigned int i = 0; i < Problem::arity; i++)
+            dcRecurse(parts[i]);
+        problem.combine(parts);
+    }
+
+    /*
+     * Class: divideConquer
+     * Divide and conquer skeleton using adaptive coarsening. Problem is
+     * default constructible and provides
+     *   static const unsigned int arity;   //parts a problem is split into
+     *   bool leaf(void);                    //small enough to solve directly
+     *   void solve(void);                   //solves a leaf
+     *   void split(Problem * parts);        //fills arity parts
+     *   void combine(Problem * parts);      //combines the solved parts
+     *   void serial(void);                  //solves the whole problem alone
+     * Each part is solved by a child divideConquer while the worker is not
+     * saturated() and by serial() once it is. serial can simply call
+     * dcRecurse(*this) when there is no better sequential algorithm. The
+     * problem given to the constructor is solved in place, it has to live
+     * until toSignal is signaled. Frames come from the worker's slab.
+     */
+    template<class Problem>
+    class divideConquer : public ThreadedProcedure, public slabAllocated
+    {
+    private:
+        class divide : public Codelet
+        {
+        public:
+            divide(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat):
+            Codelet(dep, res, myTP, stat) { }
+            
+            virtual void
+            fire(void)
+            {
+                divideConquer * myDC = static_cast<divideConquer*>(myTP_);
+                Problem * problem = myDC->problem_;
+                if(problem->leaf())
+                {
+                    problem->solve();
+                    myDC->toSignal_->decDep();
+                    return;
+                }
+                problem->split(myDC->parts_);
+                for(unsigned int i = 0; i < Problem::arity; i++)
+                {
+                    if(saturated())
+                    {
+                        myDC->parts_[i].serial();
+                        myDC->conquer_.decDep();
+                    }
+                    else
+                        invoke<divideConquer>(myDC, &myDC->parts_[i], &myDC->conquer_);
+                }
+            }
+        };
+        
+        class conquer : public Codelet
+        {
+        public:
+            conquer(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat):
+            Codelet(dep, res, myTP, stat) { }
+            
+            virtual void
+            fire(void)
+            {
+                divideConquer * myDC = static_cast<divideConquer*>(myTP_);
+                myDC->problem_->combine(myDC->parts_);
+                myDC->toSignal_->decDep();
+            }
+        };
+        
+        Problem * problem_;
+        Problem parts_[Problem::arity];
+        divide divide_;
+        conquer conquer_;
+        Codelet * toSignal_;
+        
+    public:
+        divideConquer(Problem * problem, Codelet * toSignal):
+        ThreadedProcedure(),
+        problem_(problem),
+        divide_(0, 0, this, SHORTWAIT),
+        conquer_(Problem::arity, Problem::arity, this, LONGWAIT),
+        toSignal_(toSignal)
+        {
+            add(&divide_);
+        }
+    };
+}
+#endif	/* COARSEN_H */
@@ -27,12 +27,31 @@
 
 
 #pragma once
+/*
+ * The two top bits of a codelet's status are its priority, only the
+ * TPPRIORITY/MCPRIORITY policies look at them. The rest is the locality
+ * hint TPStatic uses to route the codelet.
+ */
+#define PRIO_SHIFT 30U
+#define NUM_PRIO 4U
+#define PRIO(level) ((level) << PRIO_SHIFT)
+#define LOCALITY_MASK ((1U << PRIO_SHIFT) - 1U)
+#define PRIO_BULK PRIO(0U)
+#define PRIO_HIGH PRIO(1U)
+#define PRIO_CRITICAL PRIO(2U)
+#define PRIO_URGENT PRIO(3U)
+
 #define NIL 0U
-#define LONGWAIT 0U
+//Sync codelets waiting on several producers are usually on the critical path
+#define LONGWAIT PRIO_HIGH
 #define SHORTWAIT 0U
 #define MEMORY 1U
 #define LOCAL 2U
 
+//Kind bits of a codelet, see Codelet::streaming and <CodeletT>
+#define CODELET_STREAMING 1U
+#define CODELET_SEALED 2U
+
 /*namespace darts{
 enum codeletStatus { NIL        = 0, 
                      LONGWAIT   = 1, 
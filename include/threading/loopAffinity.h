@@ -0,0 +1,162 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef LOOPAFFINITY_H
+#define	LOOPAFFINITY_H
+#include <stdint.h>
+#include "codeletDefines.h"
+#include "Codelet.h"
+#include "ThreadedProcedure.h"
+
+namespace darts
+{
+    /*
+     * Class: loopAffinity
+     * Remembers which worker ran each iteration of a paraFor or codeletFor
+     * so the next run of the loop gives every iteration back to the same
+     * worker, and its data is still in that worker's cache. A loop given a
+     * loopAffinity with setAffinity is run by one <affinityChain> per
+     * worker. A chain first claims the iterations its worker ran last time,
+     * then the ones no worker ran yet, and only then steals from the lists
+     * of the other workers, from the end their owners reach last. The same
+     * loopAffinity has to be given to every run of the loop and outlive
+     * them, it starts over when the iteration count or the machine changes.
+     */
+    class loopAffinity
+    {
+    private:
+        //Claimed from the front by its owner and from the back by thieves
+        struct lane
+        {
+            volatile uint64_t bounds;
+            char pad[64 - sizeof(uint64_t)];
+        };
+        
+        unsigned int iterations_;
+        unsigned int slots_;
+        unsigned int * owner_;
+        unsigned int * order_;
+        unsigned int * first_;
+        //One lane per worker, the last one holds the unplaced iterations
+        lane * lanes_;
+        unsigned int moved_;
+        
+        bool takeFront(unsigned int which, unsigned int & it);
+        bool takeBack(unsigned int which, unsigned int & it);
+        
+        void clear(void);
+        
+    public:
+        loopAffinity(void);
+        ~loopAffinity(void);
+        
+        //Forgets where the iterations ran
+        void reset(void);
+        
+        //Iterations of the last run that ran on another worker than the run before
+        unsigned int getMoved(void) const { return moved_; }
+        
+        unsigned int getIterations(void) const { return iterations_; }
+        
+        /*
+         * Method: prepare
+         * Sorts the iterations by the worker that ran them last time, called
+         * by the loop codelet before it starts the chains. Returns how many
+         * chains to start.
+         */
+        unsigned int prepare(unsigned int iterations);
+        
+        /*
+         * Method: claim
+         * Picks the next iteration for the calling worker and records that
+         * it ran there. Returns false once every iteration is claimed.
+         */
+        bool claim(unsigned int & it);
+    };
+    
+    /*
+     * Class: affinityChain
+     * Runs the iterations a <loopAffinity> hands to the worker it is on,
+     * one at a time. Loop builds iteration it, signaling step, with
+     * runIteration(it, step) and is signaled once by every chain when
+     * there is nothing left to claim. Like without an affinity, an
+     * iteration signals Res times (the res of the loop codelet) before the
+     * chain moves on.
+     */
+    template< class Loop >
+    class affinityChain : public ThreadedProcedure
+    {
+    public:
+        class step : public Codelet
+        {
+        public:
+            step(ThreadedProcedure * myTP, uint32_t res):
+            Codelet(0,res,myTP,SHORTWAIT)
+            { }
+            
+            virtual void fire(void)
+            {
+                static_cast<affinityChain*>(myTP_)->next();
+            }
+        };
+        
+        Loop * owner;
+        loopAffinity * affinity;
+        bool running;
+        step next_;
+        
+        affinityChain(Loop * Owner, loopAffinity * Affinity):
+        owner(Owner),
+        affinity(Affinity),
+        running(false),
+        next_(this,Owner->Res)
+        {
+            add(&next_);
+        }
+        
+        //The chain holds a reference on itself while one of its iterations runs
+        void
+        next(void)
+        {
+            if(running)
+                deferDecRef();
+            unsigned int it = 0;
+            running = affinity->claim(it);
+            if(running)
+            {
+                next_.resetCodelet();
+                incRef();
+                owner->runIteration(it, &next_);
+            }
+            else
+                owner->decDep();
+        }
+    };
+}
+
+#endif	/* LOOPAFFINITY_H */
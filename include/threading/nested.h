@@ -35,6 +35,309 @@
 
 namespace darts
 { 
+    /*
+     * Enum: loopSchedule
+     * How a rangeFor hands its iterations to loop TPs, each loop TP runs a
+     * range of iterations.
+     *
+     * LOOP_SERIAL  - one loop TP runs every iteration
+     * LOOP_STATIC  - chunks of grain (iterations/workers when 0) dealt round robin
+     * LOOP_DYNAMIC - workers claim chunks of grain as they finish the previous one
+     * LOOP_GUIDED  - like dynamic but chunks shrink with the iterations left
+     * LOOP_LAZY    - lazy binary splitting, a chain runs chunks of grain and gives
+     *                away half of what it has left when its TP scheduler runs dry
+     */
+    enum loopSchedule
+    {
+        LOOP_SERIAL,
+        LOOP_STATIC,
+        LOOP_DYNAMIC,
+        LOOP_GUIDED,
+        LOOP_LAZY
+    };
+    
+    //The nestedLoop cut offs: serial below threshold1, spread evenly below threshold2
+    inline loopSchedule
+    thresholdSchedule(unsigned int n, unsigned int threshold1, unsigned int threshold2, loopSchedule large = LOOP_LAZY)
+    {
+        if(n < threshold1)
+            return LOOP_SERIAL;
+        if(n < threshold2)
+            return LOOP_STATIC;
+        return large;
+    }
+    
+    /*
+     * Class: rangeLoop
+     * Base of the loop TPs of a rangeFor. They are built with
+     * (start, end, toSig, args...) and signal toSig once when every
+     * iteration of [start,end) is done.
+     */
+    class rangeLoop : public ThreadedProcedure
+    {
+    public:
+        Codelet * toSignal;
+        unsigned int start;
+        unsigned int end;
+        
+        rangeLoop(unsigned int Start, unsigned int End, Codelet * toSig):
+        toSignal(toSig),
+        start(Start),
+        end(End)
+        { }
+        
+        virtual ~rangeLoop(void) {}
+    };
+    
+    //Builds the closure of the loop TP for one range
+    struct rangeClosure
+    {
+        virtual tpClosure * make(ThreadedProcedure * parent, unsigned int start, unsigned int end, Codelet * toSig) = 0;
+        virtual ~rangeClosure(void) {}
+    };
+    
+    template< class LP, class... Args >
+    struct rangeClosureArgs : rangeClosure
+    {
+        std::tuple< Args... > args;
+        
+        template< class... Fwd >
+        rangeClosureArgs(Fwd&&... fwd) :
+        args(std::forward< Fwd >(fwd)...)
+        { }
+        
+        template< size_t... I >
+        tpClosure *
+        makeClosure(ThreadedProcedure * parent, unsigned int start, unsigned int end, Codelet * toSig, indexList< I... >)
+        {
+            tpfactory funct = &TPFactory< LP, unsigned int, unsigned int, Codelet*, Args... >;
+            return new tpClosureArgs< unsigned int, unsigned int, Codelet*, Args... >(funct, parent, start, end, toSig, std::get< I >(args)...);
+        }
+        
+        virtual tpClosure *
+        make(ThreadedProcedure * parent, unsigned int start, unsigned int end, Codelet * toSig)
+        {
+            return makeClosure(parent, start, end, toSig, typename makeIndexList< sizeof...(Args) >::type());
+        }
+    };
+    
+    /*
+     * Class: rangeFor
+     * Loop codelet whose loop TPs (see <rangeLoop>) each run a range of
+     * iterations picked by a <loopSchedule>. The ranges are run by chains,
+     * small TPs that launch one loop TP at a time and claim the next range
+     * when it signals them, so only the chains and one loop TP per chain
+     * exist at a time. toSig is signaled once every iteration is done.
+     */
+    template<class LP>
+    class rangeFor : public Codelet
+    {
+    private:
+        class chain : public ThreadedProcedure
+        {
+        public:
+            class step : public Codelet
+            {
+            public:
+                step(ThreadedProcedure * myTP):
+                Codelet(0,1,myTP,SHORTWAIT)
+                { }
+                
+                virtual void fire(void)
+                {
+                    static_cast<chain*>(myTP_)->next();
+                }
+            };
+            
+            rangeFor * owner;
+            unsigned int cur;
+            unsigned int end;
+            unsigned int stride;
+            unsigned int last;
+            step next_;
+            
+            chain(rangeFor * Owner, unsigned int Start, unsigned int End, unsigned int Stride):
+            owner(Owner),
+            cur(Start),
+            end(End),
+            stride(Stride),
+            last(0),
+            next_(this)
+            {
+                add(&next_);
+            }
+            
+            //Claims the next range before retiring the last one so the
+            //loop cannot finish while this chain still uses owner
+            void
+            next(void)
+            {
+                unsigned int start = 0;
+                unsigned int stop = 0;
+                bool more = owner->claim(this, start, stop);
+                if(last)
+                    owner->retire(last);
+                last = 0;
+                if(more)
+                {
+                    last = stop - start;
+                    next_.resetCodelet();
+                    incRef();
+                    myThread.threadTPsched->pushTP(owner->closure_->make(this, start, stop, &next_));
+                }
+            }
+        };
+        
+        uint32_t Dep;
+        uint32_t Res;
+        uint32_t Stat;
+        unsigned int iterations_;
+        Codelet * toSignal_;
+        rangeClosure * closure_;
+        loopSchedule schedule_;
+        unsigned int grain_;
+        unsigned int workers_;
+        unsigned int size_;
+        unsigned int next_;
+        unsigned int remaining_;
+        
+        bool
+        claim(chain * ch, unsigned int & start, unsigned int & stop)
+        {
+            unsigned int chunk = (grain_) ? grain_ : 1;
+            switch(schedule_)
+            {
+                case LOOP_DYNAMIC:
+                    start = Atomics::fetchAdd(next_, chunk);
+                    if(start >= iterations_)
+                        return false;
+                    stop = (iterations_ - start > chunk) ? start + chunk : iterations_;
+                    return true;
+                case LOOP_GUIDED:
+                    start = next_;
+                    while(start < iterations_)
+                    {
+                        unsigned int left = iterations_ - start;
+                        unsigned int size = (left + workers_ - 1) / workers_;
+                        if(size < chunk)
+                            size = chunk;
+                        stop = (left > size) ? start + size : iterations_;
+                        if(Atomics::boolcompareAndSwap(next_, start, stop))
+                            return true;
+                        start = next_;
+                    }
+                    return false;
+                case LOOP_LAZY:
+                    if(ch->cur >= ch->end)
+                        return false;
+                    start = ch->cur;
+                    stop = (ch->end - start > chunk) ? start + chunk : ch->end;
+                    //Give half of the rest away only when nobody has queued work
+                    if(ch->end - stop > chunk && !myThread.threadTPsched->queueDepth())
+                    {
+                        unsigned int mid = stop + (ch->end - stop) / 2;
+                        invoke<chain>(ch->parentTP_, this, mid, ch->end, 0U);
+                        ch->end = mid;
+                    }
+                    ch->cur = stop;
+                    return true;
+                default:
+                    if(ch->cur >= ch->end)
+                        return false;
+                    start = ch->cur;
+                    stop = (ch->end - start > size_) ? start + size_ : ch->end;
+                    ch->cur = (ch->end - start > ch->stride) ? start + ch->stride : ch->end;
+                    return true;
+            }
+        }
+        
+        void
+        retire(unsigned int count)
+        {
+            if(count == Atomics::fetchSub(remaining_, count))
+            {
+                initCodelet(Dep,Res,myTP_,Stat);
+                toSignal_->decDep();
+            }
+        }
+        
+    public:
+        ~rangeFor(void)
+        {
+            delete closure_;
+        }
+        
+        void setIterations(unsigned int it) { iterations_=it;}
+        void setSchedule(loopSchedule sched, unsigned int grain) { schedule_=sched; grain_=grain;}
+        loopSchedule getSchedule(void) const { return schedule_; }
+        
+        template< class... Args >
+        rangeFor(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat, Codelet * toSig, unsigned int it,
+        loopSchedule sched, unsigned int grain, Args&&... args) :
+        Codelet(dep, res, myTP, stat),
+        Dep(dep),
+        Res(res),
+        Stat(stat),
+        iterations_(it),
+        toSignal_(toSig),
+        closure_(new rangeClosureArgs< LP, typename std::decay<Args>::type... >(std::forward<Args>(args)...)),
+        schedule_(sched),
+        grain_(grain),
+        workers_(1),
+        size_(0),
+        next_(0),
+        remaining_(0)
+        { }
+        
+        void fire(void)
+        {
+            if(!iterations_)
+            {
+                initCodelet(Dep,Res,myTP_,Stat);
+                toSignal_->decDep();
+                return;
+            }
+            unsigned int tps = myThread.threadTPsched->getNumTPSched();
+            unsigned int mcs = myThread.threadTPsched->getNumMCSched();
+            workers_ = tps * ((mcs) ? mcs : 1);
+            next_ = 0;
+            remaining_ = iterations_;
+            
+            unsigned int chunk = (grain_) ? grain_ : 1;
+            unsigned int chunks = (iterations_ + chunk - 1) / chunk;
+            unsigned int chains = (chunks < workers_) ? chunks : workers_;
+            switch(schedule_)
+            {
+                case LOOP_SERIAL:
+                    size_ = iterations_;
+                    invoke<chain>(myTP_, this, 0U, iterations_, iterations_);
+                    break;
+                case LOOP_STATIC:
+                    size_ = (grain_) ? grain_ : (iterations_ + workers_ - 1) / workers_;
+                    chains = (iterations_ + size_ - 1) / size_;
+                    if(chains > workers_)
+                        chains = workers_;
+                    for(unsigned int i = 0; i < chains; i++)
+                        invoke<chain>(myTP_, this, i * size_, iterations_, chains * size_);
+                    break;
+                case LOOP_LAZY:
+                    invoke<chain>(myTP_, this, 0U, iterations_, 0U);
+                    break;
+                default:
+                    for(unsigned int i = 0; i < chains; i++)
+                        invoke<chain>(myTP_, this, 0U, 0U, 0U);
+                    break;
+            }
+        }
+    };
+    
+    /*
+     * Class: nestedLoop
+     * Runs Core over [0,N) with a rangeFor: one range below threashold1,
+     * Workers even ranges below threashold2, and lazy splitting in chunks
+     * of N/(Clusters*Workers) above. Core::fire runs [start,end) and
+     * signals toSignal.
+     */
     class nestedLoop : public ThreadedProcedure
     {
     public:
@@ -60,6 +363,8 @@ namespace darts
             virtual void fire(void);
         };
 
+        //The former nesting, one loop TP per worker and per cluster, kept for
+        //code that builds them itself
         class SingleLoop: public loop
         {
         public:
@@ -104,33 +409,34 @@ namespace darts
             }
         };
 
+        class CoreRange : public rangeLoop
+        {
+        public:
+            Core core;
+
+            CoreRange(unsigned int Start, unsigned int End, Codelet * toSig, ThreadedProcedure * ParentTP):
+            rangeLoop(Start, End, toSig),
+            core(0,0,this,SHORTWAIT,Start,End,ParentTP,toSig)
+            {
+                add(&core);
+            }
+        };
+
         unsigned int n;
         unsigned int clusters;
         unsigned int workers;
-        Core core;
-        codeletFor<SingleLoop> singleLoop;
-        paraFor<DoubleLoop> doubleLoop;
+        rangeFor<CoreRange> ranges;
 
         nestedLoop(unsigned int N, unsigned int Clusters, unsigned int Workers, unsigned int threashold1, unsigned int threashold2, ThreadedProcedure * ParentTP, Codelet * toSig):
         n(N),
         clusters(Clusters),
         workers(Workers),
-        core(0,0,this,SHORTWAIT,0,N,ParentTP,toSig),
-        singleLoop(0,1,this,SHORTWAIT,toSig, GETREPS(N,Workers), 0, N, ParentTP, Workers),
-        doubleLoop(0,1,this,SHORTWAIT,toSig, GETREPS(N,Clusters), 0, N, ParentTP, Clusters, Workers)
+        ranges(0,1,this,SHORTWAIT,toSig,N,
+               thresholdSchedule(N,threashold1,threashold2),
+               (N < threashold2) ? (N + Workers - 1) / Workers : N / (Clusters * Workers),
+               ParentTP)
         {
-            if(N < threashold1)
-            {
-                add(&core);
-            }
-            else if(N < threashold2)
-            {
-                add(&singleLoop);
-            }
-            else
-            {
-                add(&doubleLoop);
-            }
+            add(&ranges);
         }
     };
     
@@ -0,0 +1,103 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PERSISTENTTP_H
+#define	PERSISTENTTP_H
+#include <vector>
+#include "codeletDefines.h"
+#include "Codelet.h"
+#include "ThreadedProcedure.h"
+
+namespace darts
+{
+    /*
+     * Class: persistentTP
+     * A TP that lives across epochs, for iterative codes that would
+     * otherwise build a new TP every time step or re-arm their codelets by
+     * hand. The TP holds a reference on itself until retire, so it is not
+     * deleted when its codelets are done. Each member codelet (addMember)
+     * calls arrive once per epoch, typically last in fire; once they all
+     * did, the epoch barrier calls epochDone. From there nextEpoch puts
+     * every member back to its reset value in one pass and adds the
+     * members marked as starting the epoch again, or retire lets the TP go.
+     * Members must not touch their counter after arrive, the next epoch
+     * may already have re-armed it.
+     */
+    class persistentTP : public ThreadedProcedure
+    {
+    private:
+        class epochBarrier : public Codelet
+        {
+        public:
+            epochBarrier(ThreadedProcedure * myTP):
+            Codelet(0, 0, myTP, LONGWAIT)
+            { }
+            
+            virtual void fire(void);
+        };
+        
+        std::vector<Codelet*> members_;
+        std::vector<Codelet*> starters_;
+        epochBarrier barrier_;
+        unsigned int epoch_;
+        bool retired_;
+        
+    public:
+        persistentTP(void);
+        
+        /*
+         * Method: addMember
+         * Adds a codelet of the TP to the epoch, starts tells whether it is
+         * added when an epoch begins. Members are added before begin.
+         */
+        void addMember(Codelet * member, bool starts = false);
+        
+        //Starts the first epoch
+        void begin(void);
+        
+        //Called by every member once per epoch
+        void arrive(void) { barrier_.decDep(); }
+        
+        //Epochs done so far, the running epoch while members fire
+        unsigned int getEpoch(void) const { return epoch_; }
+        
+        //Resets every member to its reset value
+        void rearm(void);
+        
+        //Re-arms the members and starts the next epoch
+        void nextEpoch(void);
+        
+        //Drops the reference the TP holds on itself, it is deleted once its
+        //last codelet is done
+        void retire(void);
+        
+        //Called by the epoch barrier once every member arrived
+        virtual void epochDone(void) = 0;
+    };
+}
+#endif	/* PERSISTENTTP_H */
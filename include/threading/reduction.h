@@ -0,0 +1,245 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef REDUCTION_H
+#define	REDUCTION_H
+#include <cassert>
+#include <functional>
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include "codeletDefines.h"
+#include "Codelet.h"
+#include "ThreadedProcedure.h"
+#include "threadlocal.h"
+
+//Combines of fewer elements (workers * length) are done by the reduction codelet alone
+#define REDUCE_PARALLEL_MIN 4096U
+
+namespace darts
+{
+    /*
+     * Class: reduction
+     * Sink codelet of a loop that reduces values with Op. Every worker gets
+     * its own partial of length elements, padded to a cache line and set to
+     * identity, which the loop bodies update through accumulate or local.
+     * Give the reduction as the toSig of a paraFor, codeletFor, serialFor or
+     * rangeFor: once it is signaled the partials are combined pairwise in a
+     * tree of log2(workers) levels, the result is kept in result and toSig
+     * is signaled. Large array partials are combined by one codelet per tree
+     * node so the levels run in parallel. The partials are back to identity
+     * once toSig is signaled, so the loop can run again.
+     */
+    template< class T, class Op = std::plus< T > >
+    class reduction : public Codelet
+    {
+    private:
+        class node : public Codelet
+        {
+        public:
+            reduction * owner;
+            unsigned int lo;
+            unsigned int mid;
+            Codelet * up;
+            
+            node(void) { }
+            
+            void
+            initNode(uint32_t dep, ThreadedProcedure * myTP, reduction * Owner, unsigned int Lo, unsigned int Mid, Codelet * Up)
+            {
+                initCodelet(dep,dep,myTP,SHORTWAIT);
+                owner = Owner;
+                lo = Lo;
+                mid = Mid;
+                up = Up;
+            }
+            
+            virtual void fire(void)
+            {
+                resetCodelet();
+                owner->merge(lo, mid);
+                if(up)
+                    up->decDep();
+                else
+                    owner->finish();
+            }
+        };
+        
+        Codelet * toSignal_;
+        T identity_;
+        Op op_;
+        unsigned int length_;
+        unsigned int numSlots_;
+        size_t stride_;
+        char * raw_;
+        char * slots_;
+        T * result_;
+        node * nodes_;
+        
+        T *
+        slot(unsigned int i)
+        {
+            return reinterpret_cast<T*>(slots_ + i * stride_);
+        }
+        
+        //Folds the partial of mid into the one of lo and gives mid back its identity
+        void
+        merge(unsigned int lo, unsigned int mid)
+        {
+            T * __restrict dst = slot(lo);
+            T * __restrict src = slot(mid);
+            for(unsigned int k = 0; k < length_; k++)
+            {
+                dst[k] = op_(dst[k], src[k]);
+                src[k] = identity_;
+            }
+        }
+        
+        void
+        mergeRange(unsigned int lo, unsigned int hi)
+        {
+            if(hi - lo < 2)
+                return;
+            unsigned int mid = lo + (hi - lo) / 2;
+            mergeRange(lo, mid);
+            mergeRange(mid, hi);
+            merge(lo, mid);
+        }
+        
+        void
+        finish(void)
+        {
+            T * first = slot(0);
+            for(unsigned int k = 0; k < length_; k++)
+            {
+                result_[k] = first[k];
+                first[k] = identity_;
+            }
+            toSignal_->decDep();
+        }
+        
+        //Node for [lo,hi) waits on the nodes of its two halves that hold more than one partial
+        void
+        build(unsigned int lo, unsigned int hi, Codelet * up, unsigned int & next)
+        {
+            node * me = &nodes_[next++];
+            unsigned int mid = lo + (hi - lo) / 2;
+            uint32_t dep = ((mid - lo > 1) ? 1U : 0U) + ((hi - mid > 1) ? 1U : 0U);
+            me->initNode(dep, myTP_, this, lo, mid, up);
+            if(mid - lo > 1)
+                build(lo, mid, me, next);
+            if(hi - mid > 1)
+                build(mid, hi, me, next);
+        }
+        
+        static unsigned int
+        worker(void)
+        {
+            if(myThread.threadMCsched)
+                return myThread.threadMCsched->getID();
+            return myThread.threadTPsched->getID();
+        }
+        
+    public:
+        reduction(uint32_t dep, uint32_t res, ThreadedProcedure * myTP, uint32_t stat, Codelet * toSig,
+                  const T & identity, unsigned int length = 1, Op op = Op()):
+        Codelet(dep,res,myTP,stat),
+        toSignal_(toSig),
+        identity_(identity),
+        op_(op),
+        length_((length) ? length : 1),
+        numSlots_(0),
+        nodes_(0)
+        {
+            //The slots are sized from the runtime of the worker building the
+            //reduction, built anywhere else every worker would share slot 0
+            assert(myThread.threadTPsched && "reduction built outside a worker");
+            uint64_t tps = myThread.threadTPsched->getNumTPSched();
+            uint64_t mcs = myThread.threadTPsched->getNumMCSched();
+            numSlots_ = tps * (1 + mcs);
+            stride_ = ((length_ * sizeof(T) + 63) / 64) * 64;
+            raw_ = new char[numSlots_ * stride_ + 64];
+            slots_ = reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(raw_) + 63) & ~(uintptr_t) 63);
+            for(unsigned int i = 0; i < numSlots_; i++)
+                for(unsigned int k = 0; k < length_; k++)
+                    new (&slot(i)[k]) T(identity_);
+            result_ = new T[length_];
+            for(unsigned int k = 0; k < length_; k++)
+                result_[k] = identity_;
+            if(numSlots_ > 1 && numSlots_ * length_ >= REDUCE_PARALLEL_MIN)
+            {
+                nodes_ = new node[numSlots_ - 1];
+                unsigned int next = 0;
+                build(0, numSlots_, 0, next);
+            }
+        }
+        
+        ~reduction(void)
+        {
+            for(unsigned int i = 0; i < numSlots_; i++)
+                for(unsigned int k = 0; k < length_; k++)
+                    slot(i)[k].~T();
+            delete [] raw_;
+            delete [] result_;
+            delete [] nodes_;
+        }
+        
+        //Partial of the calling worker
+        T & local(void) { return *slot(worker() % numSlots_); }
+        T * localArray(void) { return slot(worker() % numSlots_); }
+        
+        void
+        accumulate(const T & value)
+        {
+            T & mine = local();
+            mine = op_(mine, value);
+        }
+        
+        const T & result(void) const { return result_[0]; }
+        const T * resultArray(void) const { return result_; }
+        unsigned int getLength(void) const { return length_; }
+        unsigned int getNumSlots(void) const { return numSlots_; }
+        
+        virtual void fire(void)
+        {
+            resetCodelet();
+            if(!nodes_)
+            {
+                mergeRange(0, numSlots_);
+                finish();
+                return;
+            }
+            //Only the nodes over two single partials are ready
+            for(unsigned int i = 0; i < numSlots_ - 1; i++)
+                myTP_->add(&nodes_[i]);
+        }
+    };
+    
+} //namespace
+
+#endif	/* REDUCTION_H */
@@ -0,0 +1,145 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef TASKGRAPH_H
+#define	TASKGRAPH_H
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+#include <map>
+#include <set>
+#include "Lock.h"
+
+namespace darts
+{
+    class Codelet;
+    class ThreadedProcedure;
+    class TPScheduler;
+    struct tpClosure;
+    
+    /*
+     * Class: taskGraph
+     * Records the TPs and codelets of one run and replays them, the way
+     * CUDA graphs do. The first Runtime::run given a taskGraph captures:
+     * every TP built during the run is kept alive, with the children each
+     * TP invoked in order, the codelets it started with and the counters of
+     * every codelet that was signaled. Later runs replay: the counters are
+     * put back in one pass over a flat array, the root TP's first codelets
+     * are pushed again and, while replaying, invoke and place re-arm the
+     * recorded child instead of building a new TP. Codelets fire again on
+     * the frames of the first run.
+     *
+     * The graph has to be static: every TP invokes the same children with
+     * the same arguments, in an order fixed by the codelet dependencies
+     * (codelets of one TP racing to invoke are not), and codelets must not
+     * rely on frame state set by a TP constructor. TPs built by coarseInvoke
+     * on a saturated worker are not recorded. TPs the code builds or deletes
+     * on its own are not replayed either. Only one graph captures or
+     * replays at a time.
+     */
+    class taskGraph
+    {
+    private:
+        struct node
+        {
+            ThreadedProcedure * tp;
+            //Children invoked in order, in children_
+            unsigned int firstChild;
+            unsigned int numChildren;
+            //Codelets ready when the TP was built, in roots_
+            unsigned int firstRoot;
+            unsigned int numRoots;
+            //Next child to re-arm in the current replay
+            volatile unsigned int cursor;
+            bool built;
+        };
+        
+        //A codelet and the counter it had when the run first touched it
+        struct counter
+        {
+            Codelet * codelet;
+            uint32_t dep;
+            uint32_t res;
+        };
+        
+        std::vector<node> nodes_;
+        std::vector<unsigned int> children_;
+        std::vector<Codelet*> roots_;
+        std::vector<counter> counters_;
+        unsigned int root_;
+        size_t edges_;
+        bool captured_;
+        
+        //Only used while capturing, folded into the flat arrays by endCapture
+        Lock lock_;
+        std::vector< std::vector<unsigned int> > capChildren_;
+        std::vector< std::vector<Codelet*> > capRoots_;
+        std::map<tpClosure*, std::pair<unsigned int, unsigned int> > pending_;
+        std::set<Codelet*> touched_;
+        
+        static taskGraph * volatile capture_;
+        static taskGraph * volatile replay_;
+        
+        node * find(ThreadedProcedure * tp);
+        void rearm(node & child, TPScheduler * target);
+        
+    public:
+        taskGraph(void);
+        ~taskGraph(void);
+        
+        /*
+         * Method: clear
+         * Releases the recorded TPs, the next run captures again
+         */
+        void clear(void);
+        
+        bool captured(void) const { return captured_; }
+        size_t getNumTPs(void) const { return nodes_.size(); }
+        size_t getNumCodelets(void) const { return counters_.size(); }
+        //Signals and invokes seen while capturing
+        size_t getNumEdges(void) const { return edges_; }
+        
+        //Used by Runtime::run
+        void beginCapture(void);
+        void endCapture(void);
+        void beginReplay(void);
+        void endReplay(void);
+        
+        //Hooks of the TP and codelet code, cheap when nothing is captured or replayed
+        static taskGraph * capturing(void) { return capture_; }
+        static taskGraph * replaying(void) { return replay_; }
+        void keep(ThreadedProcedure * tp);
+        void built(tpClosure * closure, ThreadedProcedure * tp);
+        void invoked(ThreadedProcedure * parent, tpClosure * closure);
+        void started(ThreadedProcedure * tp, Codelet * toAdd);
+        void signaled(Codelet * codelet);
+        //Re-arms the next recorded child of parent, false when there is none
+        bool replayChild(ThreadedProcedure * parent, TPScheduler * target = NULL);
+    };
+}
+#endif	/* TASKGRAPH_H */
@@ -43,6 +43,9 @@
 #include "TPScheduler.h"
 #include "MicroScheduler.h"
 
+//Most successors a worker runs in a row before going back to its queue
+#define HANDOFF_DEPTH 16
+
 namespace darts
 {
     //forward declaration
@@ -56,6 +59,34 @@ namespace darts
         MScheduler * threadMCsched;
         char pad2[64-sizeof(Scheduler*)];
         ThreadedProcedure * tempParent;
+        //Cluster of the worker, picks its leaf in a SyncTree
+        unsigned int cluster;
+        //Last codelet enabled by the running one, fired next by this worker
+        Codelet * nextCodelet;
+        //Set while a policy is firing a codelet and will call takeNext after
+        bool handoff;
+        unsigned int handoffDepth;
+        //References dropped on refTP that are not yet folded into its ref_
+        ThreadedProcedure * refTP;
+        unsigned int refCount;
+        
+        //Called by the policy loops right before fire()
+        void
+        beginFire(void)
+        {
+            handoff = (handoffDepth < HANDOFF_DEPTH);
+        }
+        
+        //Called once the fired codelet is done, returns the successor to run or NULL
+        Codelet *
+        takeNext(void)
+        {
+            handoff = false;
+            Codelet * next = nextCodelet;
+            nextCodelet = NULL;
+            handoffDepth = (next) ? handoffDepth + 1 : 0;
+            return next;
+        }
     };
     
     extern thread_local ThreadLocalInfo myThread; 
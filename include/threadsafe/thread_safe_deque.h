@@ -116,6 +116,22 @@ public:
       return u;
     }
     
+    //Appends n items under a single lock
+    void pushBackN( const T * u, size_type n ) { darts::AutoLock lock( &mutex ); storage.insert( storage.end(), u, u + n ); }
+
+    //Pops up to max items from the back under a single lock, returns how many
+    size_type popBackN( T * u, size_type max )
+    {
+      darts::AutoLock lock( &mutex );
+      size_type n = 0;
+      while(n < max && !storage.empty())
+      {
+          u[n++] = storage.back();
+          storage.pop_back();
+      }
+      return n;
+    }
+
     void push_front( const T & u ) { darts::AutoLock lock( &mutex ); storage.push_front( u ); }
 
     void pop_front( void ) { darts::AutoLock lock( &mutex ); storage.pop_front(); }
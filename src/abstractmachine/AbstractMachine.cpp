@@ -58,7 +58,8 @@ darts :: hwloc :: AbstractMachine :: discoverTopologyWithLLC(void)
             Unit hwu(o->logical_index,t->logical_index,t->os_index);
             units[i] = hwu; // simple shallow copy
         }
-        Cluster cluster(o->logical_index,o->logical_index,nUnits,units);
+        hwloc_obj_t socket = hwloc_get_ancestor_obj_by_type(_topology,HWLOC_OBJ_SOCKET,o);
+        Cluster cluster(o->logical_index,o->logical_index,nUnits,units,(socket) ? socket->logical_index : 0);
         _clusterMap[o->logical_index] = cluster; // simple shallow copy
     }
 }
@@ -78,7 +79,7 @@ darts :: hwloc :: AbstractMachine :: discoverTopology(void)
             Unit hwu(o->logical_index,t->logical_index,t->os_index);
             units[i] = hwu; // simple shallow copy
         }
-        Cluster cluster(o->logical_index,o->logical_index,nUnits,units);
+        Cluster cluster(o->logical_index,o->logical_index,nUnits,units,o->logical_index);
         _clusterMap[o->logical_index] = cluster; // simple shallow copy
     }
 }
@@ -0,0 +1,278 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdlib.h>
+#include <atomic>
+#include <pthread.h>
+#include "slab.h"
+
+namespace darts
+{
+    namespace
+    {
+        struct freeNode
+        {
+            freeNode * next;
+        };
+        
+        class slabHeap;
+        
+        //Starts every chunk, padded so objects stay aligned
+        struct chunkHeader
+        {
+            slabHeap * owner;
+            char pad[SLAB_ALIGN * 4 - sizeof(slabHeap*)];
+        };
+        
+        //Remote frees waiting to be sent to one owner
+        struct pendingList
+        {
+            slabHeap * owner;
+            freeNode * head;
+            freeNode * tail;
+            unsigned int count;
+        };
+        
+        class slabHeap
+        {
+        private:
+            freeNode * local_[SLAB_CLASSES];
+            std::atomic<freeNode*> remote_[SLAB_CLASSES];
+            char * bump_[SLAB_CLASSES];
+            char * bumpEnd_[SLAB_CLASSES];
+            pendingList pending_[SLAB_CLASSES];
+            slabStats stats_;
+            
+            static size_t classSize(unsigned int sizeClass)
+            {
+                return (sizeClass + 1) * SLAB_ALIGN;
+            }
+            
+            void * carve(unsigned int sizeClass)
+            {
+                size_t size = classSize(sizeClass);
+                if(bump_[sizeClass] + size > bumpEnd_[sizeClass])
+                {
+                    void * chunk = NULL;
+                    if(posix_memalign(&chunk, SLAB_CHUNK, SLAB_CHUNK))
+                        throw std::bad_alloc();
+                    static_cast<chunkHeader*>(chunk)->owner = this;
+                    bump_[sizeClass] = static_cast<char*>(chunk) + sizeof(chunkHeader);
+                    bumpEnd_[sizeClass] = static_cast<char*>(chunk) + SLAB_CHUNK;
+                    stats_.chunks++;
+                }
+                void * temp = bump_[sizeClass];
+                bump_[sizeClass] += size;
+                return temp;
+            }
+            
+            void send(unsigned int sizeClass)
+            {
+                pendingList & list = pending_[sizeClass];
+                if(!list.count)
+                    return;
+                list.owner->giveBack(sizeClass, list.head, list.tail);
+                stats_.remoteBatches++;
+                list.owner = NULL;
+                list.head = list.tail = NULL;
+                list.count = 0;
+            }
+            
+        public:
+            //Links of the list of all heaps and of the heaps waiting for a thread
+            slabHeap * nextHeap;
+            slabHeap * nextOrphan;
+            
+            slabHeap(void):
+            nextHeap(NULL),
+            nextOrphan(NULL)
+            {
+                for(unsigned int i = 0; i < SLAB_CLASSES; i++)
+                {
+                    local_[i] = NULL;
+                    remote_[i].store(NULL, std::memory_order_relaxed);
+                    bump_[i] = bumpEnd_[i] = NULL;
+                    pending_[i].owner = NULL;
+                    pending_[i].head = pending_[i].tail = NULL;
+                    pending_[i].count = 0;
+                }
+            }
+            
+            void * alloc(unsigned int sizeClass)
+            {
+                stats_.allocs++;
+                freeNode * temp = local_[sizeClass];
+                if(!temp && remote_[sizeClass].load(std::memory_order_relaxed))
+                {
+                    temp = remote_[sizeClass].exchange(NULL, std::memory_order_acquire);
+                    stats_.reclaims++;
+                }
+                if(!temp)
+                    return carve(sizeClass);
+                local_[sizeClass] = temp->next;
+                return temp;
+            }
+            
+            void free(void * ptr, unsigned int sizeClass)
+            {
+                stats_.frees++;
+                freeNode * node = static_cast<freeNode*>(ptr);
+                uintptr_t chunk = reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t)(SLAB_CHUNK - 1);
+                slabHeap * owner = reinterpret_cast<chunkHeader*>(chunk)->owner;
+                if(owner == this)
+                {
+                    node->next = local_[sizeClass];
+                    local_[sizeClass] = node;
+                    return;
+                }
+                stats_.remoteFrees++;
+                pendingList & list = pending_[sizeClass];
+                if(list.owner != owner)
+                {
+                    send(sizeClass);
+                    list.owner = owner;
+                }
+                node->next = list.head;
+                list.head = node;
+                if(!list.tail)
+                    list.tail = node;
+                if(++list.count == SLAB_REMOTE_BATCH)
+                    send(sizeClass);
+            }
+            
+            //Called by other threads, splices a whole chain with one CAS
+            void giveBack(unsigned int sizeClass, freeNode * head, freeNode * tail)
+            {
+                freeNode * old = remote_[sizeClass].load(std::memory_order_relaxed);
+                do
+                {
+                    tail->next = old;
+                } while(!remote_[sizeClass].compare_exchange_weak(old, head, std::memory_order_release, std::memory_order_relaxed));
+            }
+            
+            void flush(void)
+            {
+                for(unsigned int i = 0; i < SLAB_CLASSES; i++)
+                    send(i);
+            }
+            
+            const slabStats & getStats(void) const
+            {
+                return stats_;
+            }
+        };
+        
+        //Every heap ever made, heaps are never freed
+        pthread_mutex_t heapLock = PTHREAD_MUTEX_INITIALIZER;
+        slabHeap * allHeaps = NULL;
+        slabHeap * orphans = NULL;
+        std::atomic<uint64_t> largeAllocs(0);
+        pthread_key_t heapKey;
+        pthread_once_t heapKeyOnce = PTHREAD_ONCE_INIT;
+        __thread slabHeap * threadHeap = NULL;
+        
+        //The thread is exiting, its heap waits for a new owner
+        void orphanHeap(void * heap)
+        {
+            slabHeap * temp = static_cast<slabHeap*>(heap);
+            temp->flush();
+            pthread_mutex_lock(&heapLock);
+            temp->nextOrphan = orphans;
+            orphans = temp;
+            pthread_mutex_unlock(&heapLock);
+        }
+        
+        void makeHeapKey(void)
+        {
+            pthread_key_create(&heapKey, orphanHeap);
+        }
+        
+        slabHeap * getHeap(void)
+        {
+            if(threadHeap)
+                return threadHeap;
+            pthread_once(&heapKeyOnce, makeHeapKey);
+            pthread_mutex_lock(&heapLock);
+            slabHeap * temp = orphans;
+            if(temp)
+                orphans = temp->nextOrphan;
+            pthread_mutex_unlock(&heapLock);
+            if(!temp)
+            {
+                temp = new slabHeap();
+                pthread_mutex_lock(&heapLock);
+                slabHeap ** last = &allHeaps;
+                while(*last)
+                    last = &(*last)->nextHeap;
+                *last = temp;
+                pthread_mutex_unlock(&heapLock);
+            }
+            pthread_setspecific(heapKey, temp);
+            threadHeap = temp;
+            return temp;
+        }
+    }
+    
+    void * slabAlloc(size_t size)
+    {
+        if(size > SLAB_MAX_SIZE)
+        {
+            largeAllocs.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(size);
+        }
+        unsigned int sizeClass = (size) ? (size - 1) / SLAB_ALIGN : 0;
+        return getHeap()->alloc(sizeClass);
+    }
+    
+    void slabFree(void * ptr, size_t size)
+    {
+        if(!ptr)
+            return;
+        if(size > SLAB_MAX_SIZE)
+        {
+            ::operator delete(ptr);
+            return;
+        }
+        unsigned int sizeClass = (size) ? (size - 1) / SLAB_ALIGN : 0;
+        getHeap()->free(ptr, sizeClass);
+    }
+    
+    void slabFlush(void)
+    {
+        if(threadHeap)
+            threadHeap->flush();
+    }
+    
+    void getSlabStats(slabStats & stats)
+    {
+        pthread_mutex_lock(&heapLock);
+        for(slabHeap * temp = allHeaps; temp; temp = temp->nextHeap)
+            stats.add(temp->getStats());
+        pthread_mutex_unlock(&heapLock);
+        stats.large += largeAllocs.load(std::memory_order_relaxed);
+    }
+} // namespace darts
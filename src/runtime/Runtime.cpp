@@ -31,6 +31,7 @@
 #include <time.h>
 #include "Atomics.h"
 #include "Runtime.h"
+#include "slab.h"
 
 #ifdef TRACE
 #include "getClock.h"
@@ -64,10 +65,45 @@ void * MCThread( void * args)
     rt->decFull();
     rt->spin();
     
+    myMCSched->bindThread();
     myThread.threadTPsched = myMCSched->getParentScheduler();
     myThread.threadMCsched = myMCSched;
+    myThread.cluster = mcargs->clusterId;
     
     myMCSched->policy();
+    ThreadedProcedure::foldRefs();
+    if(myMCSched->retired())
+        myMCSched->drain();
+    return 0;
+}
+
+/*Restarts a worker the elastic pool stopped, its scheduler is already linked*/
+void * MCResume( void * args)
+{
+    mcRuntimeArgs * mcargs = static_cast<mcRuntimeArgs*> (args);
+    Runtime * rt = mcargs->rt;
+    MScheduler * myMCSched = rt->getMCSched(mcargs->clusterId*rt->getNumMCS()+mcargs->unitId);
+    
+    myMCSched->bindThread();
+    myThread.threadTPsched = myMCSched->getParentScheduler();
+    myThread.threadMCsched = myMCSched;
+    myThread.cluster = mcargs->clusterId;
+    
+    myMCSched->policy();
+    ThreadedProcedure::foldRefs();
+    if(myMCSched->retired())
+        myMCSched->drain();
+    return 0;
+}
+
+void * ElasticMonitor( void * args)
+{
+    Runtime * rt = static_cast<Runtime*> (args);
+    while(rt->monitoring())
+    {
+        usleep(rt->getElasticPeriod());
+        rt->elasticTick();
+    }
     return 0;
 }
 
@@ -93,10 +129,13 @@ void * TPThread( void * args)
     rt->decFull();
     rt->spin();
     
+    myTPSched->bindThread();
     myThread.threadTPsched = myTPSched;
     myThread.threadMCsched = NULL;
+    myThread.cluster = clusterId;
     
     myTPSched->policy();
+    ThreadedProcedure::foldRefs();
     return 0;
 }
 
@@ -120,19 +159,61 @@ void TPThread0( Runtime * rt, unsigned int tpPolicy)
     while(rt->checkMC());
     rt->linkMCSched();
     
+    myTPSched->bindThread();
     myThread.threadTPsched = myTPSched;
     myThread.threadMCsched = NULL;
+    myThread.cluster = 0;
     
     rt->decFull();    
 }
 
+void * TPService( void * args)
+{
+    tpRuntimeArgs * tpargs = static_cast<tpRuntimeArgs*> (args);
+    TPScheduler * myTPSched = tpargs->rt->getTPSched(0);
+    
+    myTPSched->bindThread();
+    myThread.threadTPsched = myTPSched;
+    myThread.threadMCsched = NULL;
+    
+    myTPSched->policy();
+    ThreadedProcedure::foldRefs();
+    return 0;
+}
+
+unsigned int Runtime::clusterOfCore(unsigned int core) const
+{
+    for(unsigned int i=0;i<AbsMac.getNbClusters();i++)
+    {
+        for(unsigned int j=0;j<clusterMap[i].getNbUnits();j++)
+        {
+            if(clusterMap[i].getUnits()[j].getId() == core)
+                return i;
+        }
+    }
+    return 0;
+}
+
 void Runtime::linkTPSched()
 {
     for(unsigned int i=0;i<numTPSched_;i++)
     {
+        hwloc::Cluster & home = clusterMap[tpargs_[i].homeCluster];
+        VictimSelect * victims = TPSched_[i]->getVictimSelect();
+        victims->clear();
         for(unsigned int j=0;j<numTPSched_;j++)
         {
             TPSched_[i]->addPeer(TPSched_[j], j);
+            if(i==j)
+                continue;
+            /*Steal from the TPs sharing our cluster first, then our socket*/
+            hwloc::Cluster & other = clusterMap[tpargs_[j].homeCluster];
+            if(home.getId() == other.getId())
+                victims->addVictim(j, VICTIM_SIBLING);
+            else if(home.getSocketId() == other.getSocketId())
+                victims->addVictim(j, VICTIM_SOCKET);
+            else
+                victims->addVictim(j, VICTIM_REMOTE);
         }
     }
 }
@@ -149,12 +230,221 @@ void Runtime::linkMCSched()
     }
 }
 
+void Runtime::getParkStats(parkStats & tpStats, parkStats & mcStats) const
+{
+    for(unsigned int i=0;i<numTPSched_;i++)
+        tpStats.add(TPSched_[i]->getParkStats());
+    for(unsigned int i=0;i<numTPSched_*numMCSched_;i++)
+        mcStats.add(MCSched_[i]->getParkStats());
+}
+
+void Runtime::printParkStats(std::ostream & out) const
+{
+    parkStats tpStats, mcStats;
+    getParkStats(tpStats, mcStats);
+    out << "TP ";
+    tpStats.print(out);
+    out << "MC ";
+    mcStats.print(out);
+}
+
 void Runtime::run(tpClosure * tpToStart)
 {    
+    if(serving_)
+        stop();
     finalSignal.resetCodelet();
     TPSched_[0]->resurrect();    
     TPSched_[0]->pushTP( tpToStart );
     TPSched_[0]->policy();
+    ThreadedProcedure::foldRefs();
+}
+
+void Runtime::run(taskGraph & graph, tpClosure * tpToStart)
+{
+    if(!graph.captured())
+    {
+        graph.beginCapture();
+        run(tpToStart);
+        graph.endCapture();
+        return;
+    }
+    delete tpToStart;
+    if(serving_)
+        stop();
+    finalSignal.resetCodelet();
+    TPSched_[0]->resurrect();
+    graph.beginReplay();
+    TPSched_[0]->policy();
+    graph.endReplay();
+    ThreadedProcedure::foldRefs();
+}
+
+void Runtime::start(void)
+{
+    serveLock_.lock();
+    if(!serving_)
+    {
+        TPSched_[0]->resurrect();
+        localThreads_[0].resetArgument( &tpargs_[0] );
+        localThreads_[0].resetFunction( TPService );
+        localThreads_[0].run();
+        serving_ = true;
+    }
+    serveLock_.unlock();
+}
+
+void Runtime::stop(void)
+{
+    serveLock_.lock();
+    if(serving_)
+    {
+        TPSched_[0]->kill();
+        localThreads_[0].join();
+        /*The caller drives TP scheduler 0 again, as in run*/
+        TPSched_[0]->bindThread();
+        myThread.threadTPsched = TPSched_[0];
+        myThread.threadMCsched = NULL;
+        serving_ = false;
+    }
+    serveLock_.unlock();
+}
+
+void Runtime::submit(tpClosure * tpToStart)
+{
+    if(!serving_)
+        start();
+    /*Spread the root TPs over the clusters, the TP schedulers steal the rest*/
+    unsigned int target = Atomics::fetchAdd(nextSubmit_, 1U) % numTPSched_;
+    TPSched_[target]->pushTP( tpToStart );
+}
+
+void Runtime::printSlabStats(std::ostream & out) const
+{
+    slabStats stats;
+    getSlabStats(stats);
+    out << "Slab ";
+    stats.print(out);
+}
+
+void Runtime::getFifoStats(fifoPoolStats & stats) const
+{
+    for(unsigned int i=0;i<numTPSched_;i++)
+        stats.add(TPSched_[i]->getFifoStats());
+}
+
+void Runtime::printFifoStats(std::ostream & out) const
+{
+    fifoPoolStats stats;
+    getFifoStats(stats);
+    out << "Fifo ";
+    stats.print(out);
+}
+
+bool Runtime::addWorker(unsigned int tp)
+{
+    elasticLock_.lock();
+    size_t active = TPSched_[tp]->getNumSub();
+    if(active >= numMCSched_)
+    {
+        elasticLock_.unlock();
+        return false;
+    }
+    unsigned int slot = tp * numMCSched_ + active;
+    unsigned int tid = mcargs_[slot].threadId;
+    MScheduler * sched = MCSched_[slot];
+    lastPark_[slot] = sched->getParkStats();
+    sched->resurrect();
+    sched->retire(false);
+    finalSignal.addAliveSignal(tid, sched);
+    localThreads_[tid].resetFunction( MCResume );
+    localThreads_[tid].run();
+    mcRunning_[slot] = true;
+    /*Only now the TP scheduler starts handing it codelets*/
+    TPSched_[tp]->setNumSub(active + 1);
+    elasticLock_.unlock();
+    return true;
+}
+
+bool Runtime::removeWorker(unsigned int tp)
+{
+    elasticLock_.lock();
+    size_t active = TPSched_[tp]->getNumSub();
+    if(active <= 1)
+    {
+        elasticLock_.unlock();
+        return false;
+    }
+    unsigned int slot = tp * numMCSched_ + active - 1;
+    unsigned int tid = mcargs_[slot].threadId;
+    MScheduler * sched = MCSched_[slot];
+    TPSched_[tp]->setNumSub(active - 1);
+    /*From here pushes are refused, and the ones already in are done*/
+    sched->retire(true);
+    finalSignal.removeAliveSignal(tid);
+    sched->kill();
+    localThreads_[tid].join();
+    mcRunning_[slot] = false;
+    /*The worker is gone, hand what it left in its queue to the TP scheduler*/
+    sched->drain();
+    elasticLock_.unlock();
+    return true;
+}
+
+void Runtime::sampleWorkers(unsigned int tp, workerSample & sample)
+{
+    TPScheduler * sched = TPSched_[tp];
+    sample.tp = tp;
+    sample.workers = sched->getNumSub();
+    sample.maxWorkers = numMCSched_;
+    sample.queueDepth = sched->queueDepth();
+    sample.parks = 0;
+    sample.parkedTime = 0;
+    for(unsigned int i = 0; i < sample.workers; i++)
+    {
+        unsigned int slot = tp * numMCSched_ + i;
+        const parkStats & now = MCSched_[slot]->getParkStats();
+        sample.parks += now.parks - lastPark_[slot].parks;
+        sample.parkedTime += now.parkedTime - lastPark_[slot].parkedTime;
+        lastPark_[slot] = now;
+    }
+}
+
+void Runtime::elasticTick(void)
+{
+    uint64_t now = getTime();
+    uint64_t period = now - lastSample_;
+    lastSample_ = now;
+    for(unsigned int i = 0; i < numTPSched_; i++)
+    {
+        workerSample sample;
+        sampleWorkers(i, sample);
+        sample.period = period;
+        size_t want = elastic_->target(sample);
+        if(want < 1)
+            want = 1;
+        for(size_t n = sample.workers; n < want && addWorker(i); n++);
+        for(size_t n = sample.workers; n > want && removeWorker(i); n--);
+    }
+}
+
+void Runtime::setElasticPolicy(ElasticPolicy * policy, useconds_t period)
+{
+    if(monitoring_)
+    {
+        monitoring_ = false;
+        monitor_.join();
+    }
+    elastic_ = policy;
+    elasticPeriod_ = period;
+    if(!policy)
+        return;
+    for(unsigned int i = 0; i < numTPSched_ * numMCSched_; i++)
+        lastPark_[i] = MCSched_[i]->getParkStats();
+    lastSample_ = getTime();
+    monitoring_ = true;
+    monitor_.resetArgument( this );
+    monitor_.resetFunction( ElasticMonitor );
+    monitor_.run();
 }
 
 Runtime::Runtime(unsigned int maxCluster, unsigned int maxWorker):
@@ -173,7 +463,15 @@ papi_	     (false),
 tpcount_     (numTPSched_),
 mccount_     (numTPSched_ * numMCSched_),
 fullcount_   (numTPSched_ + numTPSched_ * numMCSched_),
-spin_        (true)
+spin_        (true),
+serving_     (false),
+nextSubmit_  (0),
+mcRunning_   (new bool[numMCSched_*numTPSched_]),
+elastic_     (NULL),
+elasticPeriod_(ELASTIC_PERIOD_US),
+monitoring_  (false),
+lastPark_    (new parkStats[numMCSched_*numTPSched_]),
+lastSample_  (0)
 {    
     if(maxCluster > AbsMac.getNbClusters() && maxCluster!=(unsigned int)-1)
       std::cerr << "maxCluster is greater than the number of available cluster" << std::endl;
@@ -183,7 +481,11 @@ spin_        (true)
     
     srand( time( 0 ) );
     
+    for(unsigned int i=0;i<numTPSched_*numMCSched_;i++)
+        mcRunning_[i] = true;
+    
     finalSignal.setNumThreads(numThreads_);
+    SyncSlot::setTreeLeaves(numTPSched_);
     
     finalSignal.setTerminate(false);
     
@@ -194,6 +496,7 @@ spin_        (true)
         tpargs_[i].threadId = tid;
         tpargs_[i].clusterId = i;
         tpargs_[i].tpSched = 0;
+        tpargs_[i].homeCluster = i;
         localThreads_[tid].resetArgument( &tpargs_[i] );
         localThreads_[tid].resetFunction( TPThread );
         localThreads_[tid].setAffinity(clusterMap[i].getUnits()[0].getId());
@@ -238,11 +541,23 @@ papi_	     (affinity->usePapi()),
 tpcount_     (numTPSched_),
 mccount_     (numTPSched_ * numMCSched_),
 fullcount_   (numTPSched_ + numTPSched_ * numMCSched_),
-spin_        (true)
+spin_        (true),
+serving_     (false),
+nextSubmit_  (0),
+mcRunning_   (new bool[numMCSched_*numTPSched_]),
+elastic_     (NULL),
+elasticPeriod_(ELASTIC_PERIOD_US),
+monitoring_  (false),
+lastPark_    (new parkStats[numMCSched_*numTPSched_]),
+lastSample_  (0)
 {     
     srand( time( 0 ) );
     
+    for(unsigned int i=0;i<numTPSched_*numMCSched_;i++)
+        mcRunning_[i] = true;
+    
     finalSignal.setNumThreads(numThreads_);
+    SyncSlot::setTreeLeaves(numTPSched_);
     
     finalSignal.setTerminate(false);
     
@@ -369,6 +684,7 @@ spin_        (true)
           nextAffinityPos = ( nextAffinityPos + numMCSched_ + 1) % dartsAffinityPosVecSize;
         }
         localThreads_[tid].setAffinity(affinCore);
+        tpargs_[i].homeCluster = (dartsAffinityPosVecSize > 0) ? clusterOfCore(affinCore) : TPaffinity->clusterID[i];
         
         if(isVerbose)
         {
@@ -443,13 +759,20 @@ spin_        (true)
 
 Runtime::~Runtime(void)
 {
+    setElasticPolicy(NULL);
+    stop();
     if(!finalSignal.getTerminate())
     {
         finalSignal.setTerminate(true);
         finalSignal.resetCodelet();
         finalSignal.decDep();
-        for (unsigned int i = 1; i < numThreads_; i++ )
-            localThreads_[i].join(); 
+        for (unsigned int i = 1; i < numTPSched_; i++ )
+            localThreads_[i * (1 + numMCSched_)].join();
+        for (unsigned int i = 0; i < numTPSched_ * numMCSched_; i++ )
+        {
+            if(mcRunning_[i])
+                localThreads_[mcargs_[i].threadId].join();
+        }
     }
     for(unsigned int i = 0;i<numTPSched_;i++)
         delete TPSched_[i];
@@ -460,4 +783,6 @@ Runtime::~Runtime(void)
     delete [] localThreads_;
     delete [] tpargs_;
     delete [] mcargs_;  
+    delete [] mcRunning_;
+    delete [] lastPark_;
 }
@@ -32,6 +32,7 @@
 #include "TPScheduler.h"
 #include "TPSchedPolicy.h"
 #include "Codelet.h"
+#include "threadlocal.h"
 
 #ifdef TRACE
 #include "getClock.h"
@@ -42,8 +43,7 @@ namespace darts
     void
     MicroStandard::policy(void)
     {
-        useconds_t usecs = 1, 
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &MicroStandard::policy);
 #endif
@@ -53,7 +53,7 @@ namespace darts
 
             while (tempCodelet)
             {
-                usecs = range; // reset sleep time
+                spins = 0; // reset idle count
                 ThreadedProcedure * checkTP = tempCodelet->getTP();
                 //Does our codelet have a TP (not final codelet)
                 //If yes then does that TP have a parent (means not a serial loop)
@@ -64,10 +64,11 @@ namespace darts
 #ifdef TRACE
                 addRecord(getTime(), tempCodelet->returnFunct());
 #endif
+                myThread.beginFire();
 #ifdef COUNT
                 if(getAffinity()) getAffinity()->startCounters(getID());
 #endif
-                tempCodelet->fire();
+                tempCodelet->dispatch();
 #ifdef COUNT
                 if(getAffinity()) getAffinity()->incrementCounters(getID());
 #endif
@@ -76,17 +77,17 @@ namespace darts
 #endif
                 if (deleteTP)
                 {
-                    if (checkTP->decRef())
-                        delete checkTP;
+                    checkTP->deferDecRef();
                 }
 
-                tempCodelet = popCodelet();
+                //Run the successor it enabled while its data is still hot
+                tempCodelet = myThread.takeNext();
+                if (!tempCodelet)
+                    tempCodelet = popCodelet();
             }
 
-            if (!tempCodelet) {
-                usleep(usecs);
-                usecs += range;
-            }
+            if (!tempCodelet)
+                idle(spins);
         }
     }
     
@@ -94,8 +95,7 @@ namespace darts
     void
     MicroStatic::policy(void)
     {
-        useconds_t usecs = 1,
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &MicroStatic::policy);
 #endif
@@ -105,7 +105,7 @@ namespace darts
 
             while (tempCodelet)
             {
-                usecs = range; // reset sleep time
+                spins = 0; // reset idle count
                 ThreadedProcedure * checkTP = tempCodelet->getTP();
                 //Does our codelet have a TP (not final codelet)
                 //If yes then does that TP have a parent (means not a serial loop)
@@ -116,10 +116,11 @@ namespace darts
 #ifdef TRACE
                 addRecord(getTime(), tempCodelet->returnFunct());
 #endif
+                myThread.beginFire();
 #ifdef COUNT
                 if(getAffinity()) getAffinity()->startCounters(getID());
 #endif
-                tempCodelet->fire();
+                tempCodelet->dispatch();
 #ifdef COUNT
                 if(getAffinity()) getAffinity()->incrementCounters(getID());
 #endif
@@ -128,15 +129,15 @@ namespace darts
 #endif
                 if (deleteTP)
                 {
-                    if (checkTP->decRef())
-                        delete checkTP;
+                    checkTP->deferDecRef();
                 }
-                tempCodelet = popCodelet();
-            }
-            if (!tempCodelet) {
-                usleep(usecs);
-                usecs += range;
+                //Run the successor it enabled while its data is still hot
+                tempCodelet = myThread.takeNext();
+                if (!tempCodelet)
+                    tempCodelet = popCodelet();
             }
+            if (!tempCodelet)
+                idle(spins);
         }
     }
     
@@ -144,8 +145,7 @@ namespace darts
     void
     MicroDynamic::policy()
     {
-        useconds_t usecs = 1, 
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &MicroDynamic::policy);
 #endif 
@@ -157,7 +157,7 @@ namespace darts
 
             while (tempCodelet)
             {
-                usecs = range; // reset sleep time
+                spins = 0; // reset idle count
                 ThreadedProcedure * checkTP = tempCodelet->getTP();
                 //Does our codelet have a TP (not final codelet)
                 //If yes then does that TP have a parent (means not a serial loop)
@@ -168,10 +168,11 @@ namespace darts
 #ifdef TRACE
                 addRecord(getTime(), tempCodelet->returnFunct());
 #endif
+                myThread.beginFire();
 #ifdef COUNT
                 if(getAffinity()) getAffinity()->startCounters(getID());
 #endif
-                tempCodelet->fire();
+                tempCodelet->dispatch();
 #ifdef COUNT
                 if(getAffinity()) getAffinity()->incrementCounters(getID());
 #endif
@@ -180,17 +181,17 @@ namespace darts
 #endif
                 if (deleteTP)
                 {
-                    if (checkTP->decRef())
-                        delete checkTP;
+                    checkTP->deferDecRef();
                 }
 
-                tempCodelet = myTPSched->popCodelet();
+                //Run the successor it enabled while its data is still hot
+                tempCodelet = myThread.takeNext();
+                if (!tempCodelet)
+                    tempCodelet = myTPSched->popCodelet();
             }
 
-            if (!tempCodelet) {
-                usleep(usecs);
-                usecs += range;
-            }
+            if (!tempCodelet)
+                idle(spins);
         }
     }
     
@@ -198,8 +199,7 @@ namespace darts
     void
     MicroSteal::policy()
     {
-        useconds_t usecs = 1, 
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &MicroSteal::policy);
 #endif 
@@ -209,19 +209,23 @@ namespace darts
             if(!tempCodelet)
                 tempCodelet = stealCodelet();
 
-            if(tempCodelet)
+            if(!tempCodelet)
+                idle(spins);
+
+            while(tempCodelet)
             {
-                usecs = range; // reset sleep time
+                spins = 0; // reset idle count
                 ThreadedProcedure * checkTP = tempCodelet->getTP();
                 bool deleteTP = (checkTP) ? checkTP->checkParent() : false;
 
 #ifdef TRACE
                 addRecord(getTime(), tempCodelet->returnFunct());
 #endif
+                myThread.beginFire();
 #ifdef COUNT
                 if(getAffinity()) getAffinity()->startCounters(getID());
 #endif
-                tempCodelet->fire();
+                tempCodelet->dispatch();
 #ifdef COUNT
                 if(getAffinity()) getAffinity()->incrementCounters(getID());
 #endif
@@ -230,13 +234,63 @@ namespace darts
 #endif
                 if (deleteTP)
                 {
-                    if (checkTP->decRef())
-                        delete checkTP;
+                    checkTP->deferDecRef();
+                }
+                //Run the successor it enabled while its data is still hot
+                tempCodelet = myThread.takeNext();
+            }
+        }
+    }
+    
+    // Pops the most urgent codelet out of its own and the parent's queue, fires them
+    void
+    MicroPriority::policy()
+    {
+        unsigned int spins = 0;
+#ifdef TRACE
+        addRecord(getTime(), (void*) &MicroPriority::policy);
+#endif 
+        while (alive())
+        {
+            Codelet * tempCodelet = popCodelet();
+
+            while (tempCodelet)
+            {
+                spins = 0; // reset idle count
+                ThreadedProcedure * checkTP = tempCodelet->getTP();
+                //Does our codelet have a TP (not final codelet)
+                //If yes then does that TP have a parent (means not a serial loop)
+                //If yes then delete the TP
+                //Else do not delete the TP
+                bool deleteTP = (checkTP) ? checkTP->checkParent() : false;
+
+#ifdef TRACE
+                addRecord(getTime(), tempCodelet->returnFunct());
+#endif
+                myThread.beginFire();
+#ifdef COUNT
+                if(getAffinity()) getAffinity()->startCounters(getID());
+#endif
+                tempCodelet->dispatch();
+#ifdef COUNT
+                if(getAffinity()) getAffinity()->incrementCounters(getID());
+#endif
+#ifdef TRACE
+                addRecord(getTime(), (void*) &MicroPriority::policy);
+#endif
+                if (deleteTP)
+                {
+                    checkTP->deferDecRef();
                 }
-            } else { 
-                usleep(usecs);
-                usecs += range;
+
+                //Run the successor it enabled while its data is still hot
+                tempCodelet = myThread.takeNext();
+                if (!tempCodelet)
+                    tempCodelet = popCodelet();
             }
+
+            if (!tempCodelet)
+                idle(spins);
         }
     }
     
@@ -247,6 +301,7 @@ namespace darts
         if (type==MCSTATIC) return new MicroStatic;      // same as microstandard? Pops codelets from own queue and fires them
         if (type==MCDYNAMIC) return new MicroDynamic;    // Only pops Codelet's from parent (TP) scheduler's codelet queue, fires them
         if (type==MCSTEAL) return new MicroSteal;        // Pops codelets from its own queue; if none exist, steals codelet from elsewhere; fires codelets
+        if (type==MCPRIORITY) return new MicroPriority;  // Pops the most urgent codelet from its own or the parent's queue (with aging); fires codelets
         else return NULL;
     }
     
@@ -34,6 +34,7 @@
 #include "MicroScheduler.h"
 #include <cstdlib>
 #include "tpClosure.h"
+#include "threadlocal.h"
 #ifdef TRACE
 #include "getClock.h"
 #endif
@@ -49,16 +50,12 @@ namespace darts {
 	    // Make scheduling decision here -- not now but in the future
 	    // for example, decDep consumer and see if it is ready; if its not yet
 	    // then store farther away. If it is, use HW Fifo when available 
-	    // new Fifo, set producer/consumer values on Fifo
-	    Fifo * streamFifo = producerCod->generateFifo(0, 0, 0, 10, producerCod->getConsumerCod());
-	    producerCod->setConsumer(streamFifo);
-	    (producerCod->getConsumerCod())->setProducer(streamFifo);
+	    // new Fifo (SPSC, MPSC, SPMC or MPMC), set producer/consumer values on Fifo,
+	    // or the Fifo another producer of a fan-in already created
+	    Fifo * streamFifo = wireFifo(producerCod);
 	    // here we're not setting producer because this Codelet does not have a Fifo
 	    // producing for it -- or if it does then it is already assigned 
-	    // add Fifo to SU-managed table
-	    fifos_.push(streamFifo);
-	    //consumer should have only 1 dep; all others are intrinsic through producer Codelet
-	    producerCod->decDepConsumerCod();
+	    // the Fifo is in the SU-managed pool, which takes it back once its codelets let go
 	    //std::cout << "consumer fifo points to " << producerCod->getConsumer() << std::endl;
 	    //std::cout << "producer fifo points to " << (producerCod->getConsumerCod())->getProducer() << std::endl; 
 	    //std::cout << "Fifo allocated" << std::endl;
@@ -69,19 +66,19 @@ namespace darts {
     // Creates TPs from TPClosures; pops Codelets from queue and distributes them evenly to MCSchedulers
     void
     TPRoundRobin::policy() {
-        useconds_t usecs = 1,
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &TPRoundRobin::policy);
 #endif       
         while (alive()) {
+            bool worked = false;
             //Check if we have any work in our deque
             tpClosure * tempClosure;
             if (!(tempClosure = popTP()))
                 tempClosure = steal();
 
             if (tempClosure) {
-                usecs = range; // reset sleep time
+                worked = true;
 #ifdef TRACE
                 addRecord(getTime(), (void*) tempClosure->factory);
 #endif
@@ -91,33 +88,38 @@ namespace darts {
 #endif
                 delete tempClosure;
                 //Get the work ready!
-            } else {
-                usleep(usecs);
-                if (usecs < 500)
-                    usecs *= 2;
             }
             //Lets do the work!
-            Codelet * tempCodelet = popCodelet();
-	    //check if Codelet expects streamed input/output
-	    //if it is Streaming but doesn't have a consumer Codelet, it is the end of a pipeline
-	    if (tempCodelet) { //check in case pop returns nullptr
-	        if (tempCodelet->isStreaming() && (tempCodelet->getConsumerCod() != nullptr)) {
-                    this->allocateFifo(tempCodelet);
+            Codelet * batch[CODELET_BATCH];
+            size_t count = popCodeletBatch(batch, getCodeletBatch());
+            if (count || worked)
+                spins = 0; // reset idle count
+            else
+                idle(spins);
+            while (count) {
+                //check if Codelet expects streamed input/output
+                //if it is Streaming but doesn't have a consumer Codelet, it is the end of a pipeline
+                //a producer rescheduled by its Fifo already has one
+                for (size_t i = 0; i < count; i++) {
+                    if (batch[i]->streaming() && (batch[i]->getConsumerCod() != nullptr) && !batch[i]->getConsumer()) {
+                        this->allocateFifo(batch[i]);
+                    }
                 }
-	    }
-	    //allocate Fifo (later can possibly reuse allocated Fifos depending on settings?)
-	    //update Fifo book keeping
-	    //set Codelet's pointer(s)
-	    //need a second variable to indicate which codelet is connected to this one.
-	    //could go with unique Fifo IDs
-            while (tempCodelet) {
-                MScheduler * myCDS = static_cast<MScheduler*> (getSubScheduler(getSubIndexInc()));
-                //std::cout << "TPScheduler trying to push codelet . . ." << std::endl;
-                while (!myCDS->pushCodelet(tempCodelet)) {
-                    myCDS = static_cast<MScheduler*> (getSubScheduler(getSubIndexInc()));
+	        //allocate Fifo (later can possibly reuse allocated Fifos depending on settings?)
+	        //update Fifo book keeping
+	        //set Codelet's pointer(s)
+	        //need a second variable to indicate which codelet is connected to this one.
+	        //could go with unique Fifo IDs
+                //Give each MCScheduler an even slice of the batch, in round robin order
+                size_t numSub = getNumSub();
+                size_t share = (count + numSub - 1) / numSub;
+                size_t done = 0;
+                while (done < count) {
+                    MScheduler * myCDS = static_cast<MScheduler*> (getSubScheduler(getSubIndexInc()));
+                    size_t chunk = (count - done < share) ? count - done : share;
+                    done += myCDS->pushCodeletBatch(&batch[done], chunk);
                 }
-                //std::cout << "Codelet successfully pushed" << std::endl;
-                tempCodelet = popCodelet();
+                count = popCodeletBatch(batch, getCodeletBatch());
             }
         }
     }
@@ -125,19 +127,19 @@ namespace darts {
     // Creates TPs; pops codelets and attempts to push them to MCSchedulers; if it fails, executes Codelet itself
     void
     TPPushFull::policy() {
-        useconds_t usecs = 1, 
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &TPPushFull::policy);
 #endif
         while (alive()) {
+            bool worked = false;
             //Check if we have any work in our deque
             tpClosure * tempClosure = popTP();
             if (!tempClosure)
                 tempClosure = steal();
 
             if (tempClosure) {
-                usecs = range; // reset sleep time
+                worked = true;
 #ifdef TRACE
                 addRecord(getTime(), (void*) tempClosure->factory);
 #endif
@@ -147,46 +149,54 @@ namespace darts {
 #endif
                 delete tempClosure;
                 //Get the work ready!
-            } else {
-                usleep(usecs);
-                if (usecs < 500)
-                    usecs *= 2;
-           }
+            }
             //Lets do the work!
-            Codelet * tempCodelet = popCodelet();
-            while (tempCodelet) {
-                //Here we are going to try to push
-                bool fail = true;
-                for (size_t i = 0; i < getNumSub(); i++) {
-                    MScheduler * myCDS = static_cast<MScheduler*> (getSubScheduler(getSubIndexInc()));
-                    if (myCDS->pushCodelet(tempCodelet)) {
-                        fail = false;
-                        break;
+            Codelet * batch[CODELET_BATCH];
+            size_t count = popCodeletBatch(batch, getCodeletBatch());
+            if (count || worked)
+                spins = 0; // reset idle count
+            else
+                idle(spins);
+            while (count) {
+                size_t numSub = getNumSub();
+                size_t share = (numSub) ? (count + numSub - 1) / numSub : count;
+                size_t done = 0;
+                while (done < count) {
+                    //Here we are going to try to push, one slice per MCScheduler
+                    bool fail = true;
+                    for (size_t i = 0; i < numSub && done < count; i++) {
+                        MScheduler * myCDS = static_cast<MScheduler*> (getSubScheduler(getSubIndexInc()));
+                        size_t chunk = (count - done < share) ? count - done : share;
+                        size_t pushed = myCDS->pushCodeletBatch(&batch[done], chunk);
+                        if (pushed) {
+                            fail = false;
+                            done += pushed;
+                        }
                     }
-                }
-                //If we fail do it ourself
-                if (fail) {
-                    ThreadedProcedure * checkTP = tempCodelet->getTP();
-                    bool deleteTP = (checkTP) ? checkTP->checkParent() : false;
+                    //If everybody is full do one ourself
+                    if (fail) {
+                        Codelet * tempCodelet = batch[done++];
+                        ThreadedProcedure * checkTP = tempCodelet->getTP();
+                        bool deleteTP = (checkTP) ? checkTP->checkParent() : false;
 #ifdef TRACE
-                    addRecord(getTime(), tempCodelet->returnFunct());
+                        addRecord(getTime(), tempCodelet->returnFunct());
 #endif
 #ifdef COUNT
-		    if(getAffinity()) getAffinity()->startCounters(getID());
+		        if(getAffinity()) getAffinity()->startCounters(getID());
 #endif
-		    tempCodelet->fire();
+		        tempCodelet->dispatch();
 #ifdef COUNT
-		    if(getAffinity()) getAffinity()->incrementCounters(getID());
+		        if(getAffinity()) getAffinity()->incrementCounters(getID());
 #endif
 #ifdef TRACE
-                    addRecord(getTime(), (void*) &TPPushFull::policy);
+                        addRecord(getTime(), (void*) &TPPushFull::policy);
 #endif
-                    if (deleteTP) {
-                        if (checkTP->decRef())
-                            delete checkTP;
+                        if (deleteTP) {
+                            checkTP->deferDecRef();
+                        }
                     }
                 }
-                tempCodelet = popCodelet();
+                count = popCodeletBatch(batch, getCodeletBatch());
             }
         }
     }
@@ -194,19 +204,19 @@ namespace darts {
     // Creates TPs; pops Codelets and fires them; DOES NOT distribute codelets to MCSchedulers
     void
     TPStatic::policy() {
-        useconds_t usecs = 1, 
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &TPStatic::policy);
 #endif
         while (alive()) {
+            bool worked = false;
             //Check if we have any work in our deque
             tpClosure * tempClosure = popTP();
             if (!tempClosure)
                 tempClosure = steal();
 
             if (tempClosure) {
-                usecs = range; // reset sleep time
+                worked = true;
 #ifdef TRACE
                 addRecord(getTime(), (void*) tempClosure->factory);
 #endif
@@ -216,23 +226,24 @@ namespace darts {
 #endif
                 delete tempClosure;
                 //Get the work ready!
-            } else {
-                usleep(usecs);
-                if (usecs < 500)
-                    usecs *= 2;
-           }
+            }
 
             Codelet * tempCodelet = popCodelet();
+            if (tempCodelet || worked)
+                spins = 0; // reset idle count
+            else
+                idle(spins);
             while (tempCodelet) {
                 ThreadedProcedure * checkTP = tempCodelet->getTP();
                 bool deleteTP = (checkTP) ? checkTP->checkParent() : false;
 #ifdef TRACE
                 addRecord(getTime(), tempCodelet->returnFunct());
 #endif
+                myThread.beginFire();
 #ifdef COUNT
 		    if(getAffinity()) getAffinity()->startCounters(getID());
 #endif
-		    tempCodelet->fire();
+		    tempCodelet->dispatch();
 #ifdef COUNT
 		    if(getAffinity()) getAffinity()->incrementCounters(getID());
 #endif
@@ -240,10 +251,11 @@ namespace darts {
                 addRecord(getTime(), (void*) &TPStatic::policy);
 #endif
                 if (deleteTP) {
-                    if (checkTP->decRef())
-                        delete checkTP;
+                    checkTP->deferDecRef();
                 }
-                tempCodelet = popCodelet();
+                tempCodelet = myThread.takeNext();
+                if (!tempCodelet)
+                    tempCodelet = popCodelet();
             }
         }
     }
@@ -253,14 +265,27 @@ namespace darts {
     bool
     TPStatic::pushCodelet(Codelet * CodeletToPush) 
     {
-        uint64_t status = CodeletToPush->getStatus();
+        uint64_t status = CodeletToPush->getLocality();
         size_t numSub = getNumSub();
         if (!status || !numSub)
         {
-            return codelets_.push(CodeletToPush);
+            return TPScheduler::pushCodelet(CodeletToPush);
         }
         MScheduler * myCDS = static_cast<MScheduler*> (getSubScheduler((status - 1) % numSub));
-        return myCDS->pushCodelet(CodeletToPush);
+        //A full or stopped MCScheduler leaves it to whoever pops our queue
+        if (myCDS->pushCodelet(CodeletToPush))
+            return true;
+        return TPScheduler::pushCodelet(CodeletToPush);
+    }
+
+    // Codelets are routed one by one since each status may pick a different MCScheduler
+    size_t
+    TPStatic::pushCodeletBatch(Codelet ** codeletsToPush, size_t n)
+    {
+        size_t i = 0;
+        while (i < n && pushCodelet(codeletsToPush[i]))
+            i++;
+        return i;
     }
 
     /* TODO: make this work with other MCSchedPolicies. DO NOT use this or StreamingCodelets with the
@@ -274,16 +299,12 @@ namespace darts {
 	    // Make scheduling decision here -- not now but in the future
 	    // for example, decDep consumer and see if it is ready; if its not yet
 	    // then store farther away. If it is, use HW Fifo when available 
-	    // new Fifo, set producer/consumer values on Fifo
-	    Fifo * streamFifo = producerCod->generateFifo(0, 0, 0, 10, producerCod->getConsumerCod());
-	    producerCod->setConsumer(streamFifo);
-	    (producerCod->getConsumerCod())->setProducer(streamFifo);
+	    // new Fifo (SPSC, MPSC, SPMC or MPMC), set producer/consumer values on Fifo,
+	    // or the Fifo another producer of a fan-in already created
+	    Fifo * streamFifo = wireFifo(producerCod);
 	    // here we're not setting producer because this Codelet does not have a Fifo
 	    // producing for it -- or if it does then it is already assigned 
-	    // add Fifo to SU-managed table
-	    fifos_.push(streamFifo);
-	    //consumer should have only 1 dep; all others are intrinsic through producer Codelet
-	    producerCod->decDepConsumerCod();
+	    // the Fifo is in the SU-managed pool, which takes it back once its codelets let go
 	    //std::cout << "consumer fifo points to " << producerCod->getConsumer() << std::endl;
 	    //std::cout << "producer fifo points to " << (producerCod->getConsumerCod())->getProducer() << std::endl; 
 	    //std::cout << "Fifo allocated" << std::endl;
@@ -294,19 +315,19 @@ namespace darts {
     // Creates TPs, pops codelets from own queue and fires them; DOES NOT distribute codelets
     void
     TPDynamic::policy() {
-        useconds_t usecs = 1, 
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &TPDynamic::policy);
 #endif
         while (alive()) {
+            bool worked = false;
             //Check if we have any work in our deque
             tpClosure * tempClosure;
             if (!(tempClosure = popTP()))
                 tempClosure = steal();
 
             if (tempClosure) {
-                usecs = range; // reset sleep time;
+                worked = true;
 #ifdef TRACE
                 addRecord(getTime(), (void*) tempClosure->factory);
 #endif
@@ -316,16 +337,16 @@ namespace darts {
 #endif
                 delete tempClosure;
                 //Get the work ready!
-            } else {
-                usleep(usecs);
-                if (usecs < 500)
-                    usecs *= 2;
-           }
+            }
 
             //Lets do the work!
             Codelet * tempCodelet = popCodelet();
+            if (tempCodelet || worked)
+                spins = 0; // reset idle count
+            else
+                idle(spins);
 	    if (tempCodelet) { //make sure not nullptr before accessing methods
-                if (tempCodelet->isStreaming() && (tempCodelet->getConsumerCod() != nullptr)) {
+                if (tempCodelet->streaming() && (tempCodelet->getConsumerCod() != nullptr) && !tempCodelet->getConsumer()) {
                     //std::cout << "inside TPScheduler streaming-if statement" << std::endl;
                     this->allocateFifo(tempCodelet);
                 }
@@ -336,10 +357,11 @@ namespace darts {
 #ifdef TRACE
                 addRecord(getTime(), tempCodelet->returnFunct());
 #endif
+                myThread.beginFire();
 #ifdef COUNT
 		    if(getAffinity()) getAffinity()->startCounters(getID());
 #endif
-		    tempCodelet->fire();
+		    tempCodelet->dispatch();
 #ifdef COUNT
 		    if(getAffinity()) getAffinity()->incrementCounters(getID());
 #endif
@@ -347,14 +369,14 @@ namespace darts {
                 addRecord(getTime(), (void*) &TPDynamic::policy);
 #endif
                 if (deleteTP) {
-                    if (checkTP->decRef())
-                        delete checkTP;
+                    checkTP->deferDecRef();
                 }
 
-                tempCodelet = popCodelet();
-		// TODO: add mechanism for bookkeeping (deleting Fifos that are out of use)
+                tempCodelet = myThread.takeNext();
+                if (!tempCodelet)
+                    tempCodelet = popCodelet();
 		if (tempCodelet) { //make sure not nullptr before accessing methods
-	            if (tempCodelet->isStreaming() && (tempCodelet->getConsumerCod() != nullptr)) {
+	            if (tempCodelet->streaming() && (tempCodelet->getConsumerCod() != nullptr) && !tempCodelet->getConsumer()) {
 		        //std::cout << "inside TPScheduler streaming-if statement" << std::endl;
                         this->allocateFifo(tempCodelet);
                     }
@@ -368,17 +390,17 @@ namespace darts {
     // Makes TPs; Distributes Codelets; DOES NOT fire codelets ever
     void
     TPWorkPush::policy() {
-        useconds_t usecs = 1,
-                   range = 1;
+        unsigned int spins = 0;
 #ifdef TRACE
         addRecord(getTime(), (void*) &TPWorkPush::policy);
 #endif
         while (alive()) {
+            bool worked = false;
             //Check if we have any work in our deque
             tpClosure * tempClosure = popTP();
 
             if (tempClosure) {
-                usecs = range; // reset sleep time
+                worked = true;
 #ifdef TRACE
                 addRecord(getTime(), (void*) tempClosure->factory);
 #endif
@@ -388,24 +410,84 @@ namespace darts {
 #endif
                 delete tempClosure;
                 //Get the work ready!
-            } else {
-                usleep(usecs);
-                if (usecs < 500)
-                    usecs *= 2;
-           }
+            }
             //Lets do the work!
+            Codelet * batch[CODELET_BATCH];
+            size_t count = popCodeletBatch(batch, getCodeletBatch());
+            if (count || worked)
+                spins = 0; // reset idle count
+            else
+                idle(spins);
+            while (count) {
+                //Here we are going to push, one slice per MCScheduler until all are taken
+                size_t numSub = getNumSub();
+                size_t share = (count + numSub - 1) / numSub;
+                size_t done = 0;
+                while (done < count) {
+                    MScheduler * myCDS = static_cast<MScheduler*> (getSubScheduler(getSubIndexInc()));
+                    size_t chunk = (count - done < share) ? count - done : share;
+                    done += myCDS->pushCodeletBatch(&batch[done], chunk);
+                }
+                count = popCodeletBatch(batch, getCodeletBatch());
+            }
+        }
+    }
+
+    // Creates TPs; pops the most urgent Codelet and fires it; children pop the same queue
+    void
+    TPPriority::policy() {
+        unsigned int spins = 0;
+#ifdef TRACE
+        addRecord(getTime(), (void*) &TPPriority::policy);
+#endif
+        while (alive()) {
+            bool worked = false;
+            //Check if we have any work in our deque
+            tpClosure * tempClosure = popTP();
+            if (!tempClosure)
+                tempClosure = steal();
+
+            if (tempClosure) {
+                worked = true;
+#ifdef TRACE
+                addRecord(getTime(), (void*) tempClosure->factory);
+#endif
+                tempClosure->factory(tempClosure);
+#ifdef TRACE
+                addRecord(getTime(), (void*) &TPPriority::policy);
+#endif
+                delete tempClosure;
+                //Get the work ready!
+            }
+
             Codelet * tempCodelet = popCodelet();
+            if (tempCodelet || worked)
+                spins = 0; // reset idle count
+            else
+                idle(spins);
             while (tempCodelet) {
-                //Here we are going to try to push
-                bool fail = true;
-                while (fail) {
-                    MScheduler * myCDS = static_cast<MScheduler*> (getSubScheduler(getSubIndexInc()));
-                    if (myCDS->pushCodelet(tempCodelet)) {
-                        fail = false;
-                        break;
-                    }
+                ThreadedProcedure * checkTP = tempCodelet->getTP();
+                bool deleteTP = (checkTP) ? checkTP->checkParent() : false;
+#ifdef TRACE
+                addRecord(getTime(), tempCodelet->returnFunct());
+#endif
+                myThread.beginFire();
+#ifdef COUNT
+		    if(getAffinity()) getAffinity()->startCounters(getID());
+#endif
+		    tempCodelet->dispatch();
+#ifdef COUNT
+		    if(getAffinity()) getAffinity()->incrementCounters(getID());
+#endif
+#ifdef TRACE
+                addRecord(getTime(), (void*) &TPPriority::policy);
+#endif
+                if (deleteTP) {
+                    checkTP->deferDecRef();
                 }
-                tempCodelet = popCodelet();
+                tempCodelet = myThread.takeNext();
+                if (!tempCodelet)
+                    tempCodelet = popCodelet();
             }
         }
     }
@@ -417,6 +499,7 @@ namespace darts {
         if (type == TPPUSHFULL) return new TPPushFull;     // Creates TPs; pops codelets and attempts to push them to MCSchedulers; if it fails, executes Codelet itself
         if (type == TPSTATIC) return new TPStatic;         // Creates TPs; pops Codelets and fires them; DOES NOT distribute codelets to MCSchedulers
         if (type == TPDYNAMIC) return new TPDynamic;       // Creates TPs, pops codelets from own queue and fires them; DOES NOT distribute codelets
+        if (type == TPPRIORITY) return new TPPriority;     // Creates TPs, pops codelets by priority (with aging) and fires them; DOES NOT distribute codelets
         else return NULL;
     }
 
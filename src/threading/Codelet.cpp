@@ -36,6 +36,7 @@
 #include "ThreadedProcedure.h"
 #include "threadlocal.h"
 #include "MSchedPolicy.h"
+#include "taskGraph.h"
 #include <cassert>
 
 namespace darts
@@ -43,12 +44,14 @@ namespace darts
     
     Codelet::Codelet(uint32_t dep, uint32_t res, ThreadedProcedure * theTp, uint32_t stat):
     status_(stat),
+    kind_(0),
     sync_(dep,res),
     myTP_(theTp) 
     { }
 
     Codelet::Codelet(void):
     status_(NIL),
+    kind_(0),
     sync_(0U,0U),
     myTP_(0) { }
 
@@ -66,22 +69,57 @@ namespace darts
     Codelet::decDep(void)
     {
         //std::cout << "dep being dec'd" << std::endl;
+        if(taskGraph * graph = taskGraph::capturing())
+            graph->signaled(this);
         if(sync_.decCounter())
         {
             if(myTP_)
                 myTP_->incRef();
-            if(myThread.threadMCsched)
+            //Keep the last codelet enabled by the running one so the worker fires it
+            //right after, unless it has a locality hint or needs a Fifo from its TP scheduler
+            if(myThread.handoff && !getLocality() && !streaming())
             {
-                if(myThread.threadMCsched->getLocal())
-                {
-                        if(myThread.threadMCsched->pushLocal(this))
-                                return;
-                }
+                Codelet * previous = myThread.nextCodelet;
+                myThread.nextCodelet = this;
+                if(previous)
+                    previous->enqueue();
+                return;
             }
-            myThread.threadTPsched->pushCodelet(this);
+            enqueue();
         }
     }
 
+    void
+    Codelet::reschedule(void)
+    {
+        //The reference the codelet held on its TP while parked goes to this firing
+        //Its Fifos are already there, so unlike decDep a streaming codelet can be
+        //handed to this worker, unless a parked worker could run it right now
+        if(myThread.handoff && !getLocality() && !myThread.threadTPsched->hasIdle())
+        {
+            Codelet * previous = myThread.nextCodelet;
+            myThread.nextCodelet = this;
+            if(previous)
+                previous->enqueue();
+            return;
+        }
+        enqueue();
+    }
+
+    void
+    Codelet::enqueue(void)
+    {
+        if(myThread.threadMCsched)
+        {
+            if(myThread.threadMCsched->getLocal())
+            {
+                    if(myThread.threadMCsched->pushLocal(this))
+                            return;
+            }
+        }
+        myThread.threadTPsched->pushCodelet(this);
+    }
+
     void 
     Codelet::resetCodelet(void)
     {
@@ -109,17 +147,21 @@ namespace darts
     uint32_t Codelet::getStatus(void) const{
         return status_;
     }
-    
-    bool
-    Codelet::casStatus(uint32_t oldval, uint32_t newval )
+
+    void 
+    Codelet::setPriority(uint32_t level)
     {
-        return Atomics::boolcompareAndSwap(status_,oldval,newval);
+        status_ = (status_ & LOCALITY_MASK) | PRIO(level % NUM_PRIO);
+    }
+
+    uint32_t Codelet::getPriority(void) const{
+        return status_ >> PRIO_SHIFT;
     }
 
-    ThreadedProcedure * 
-    Codelet::getTP(void)
+    bool
+    Codelet::casStatus(uint32_t oldval, uint32_t newval )
     {
-        return myTP_;
+        return Atomics::boolcompareAndSwap(status_,oldval,newval);
     }
 
     void 
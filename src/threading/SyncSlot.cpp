@@ -0,0 +1,70 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "SyncSlot.h"
+#include "threadlocal.h"
+
+namespace darts
+{
+    unsigned int SyncSlot::treeThreshold_ = SYNC_TREE_THRESHOLD;
+    unsigned int SyncSlot::treeLeaves_ = 1;
+    
+    void
+    SyncSlot::shape(uint32_t count)
+    {
+        bool tree = (treeLeaves_ > 1);
+        if(mode_ == SYNC_FLAT)
+            tree = false;
+        else if(mode_ == SYNC_AUTO && !tree_)
+            tree = tree && treeThreshold_ && (count >= treeThreshold_);
+        
+        if(!tree)
+        {
+            delete tree_;
+            tree_ = 0;
+        }
+        else if(tree_ && tree_->getNumLeaves() == treeLeaves_)
+            tree_->arm(count);
+        else
+        {
+            delete tree_;
+            tree_ = new SyncTree(treeLeaves_, count);
+        }
+    }
+    
+    bool
+    SyncSlot::treeDec(void)
+    {
+        return tree_->decCounter(myThread.cluster);
+    }
+    
+    void
+    SyncSlot::treeInc(void)
+    {
+        tree_->incCounter(myThread.cluster);
+    }
+}
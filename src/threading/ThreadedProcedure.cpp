@@ -33,13 +33,21 @@
 #include "codeletDefines.h"
 #include "Atomics.h"
 #include "threadlocal.h"
+#include "taskGraph.h"
 
 namespace darts
 {
+    bool ThreadedProcedure::deferRefs_ = true;
+
     //Make the defualt reference count 1 so when stealing the TP will not be deleted prematurely
     ThreadedProcedure::ThreadedProcedure(void):
     ref_(1),
-    parentTP_(myThread.tempParent){ }
+    node_(0),
+    parentTP_(myThread.tempParent)
+    {
+        if(taskGraph * graph = taskGraph::capturing())
+            graph->keep(this);
+    }
 
     //This is for paraFor loop
     //ThreadedProcedure::ThreadedProcedure(unsigned int num, ThreadedProcedure * parentTP):
@@ -73,34 +81,71 @@ namespace darts
     void 
     ThreadedProcedure::incRef(void)
     {
+        //A reference this worker still defers on the TP is simply handed back
+        if(myThread.refTP == this)
+        {
+            if(!--myThread.refCount)
+                myThread.refTP = NULL;
+            return;
+        }
         Atomics::fetchAdd(ref_, 1U);
     }
     
-    bool
-    ThreadedProcedure::zeroRef(void)
+    //ref_ never drops below the live count plus what workers defer, so it
+    //can only reach zero in the fold of the last deferred reference
+    void 
+    ThreadedProcedure::deferDecRef(void)
     {
-        return (!ref_);
+        if(!deferRefs_)
+        {
+            if(decRef())
+                delete this;
+            return;
+        }
+        if(myThread.refTP != this)
+        {
+            foldRefs();
+            myThread.refTP = this;
+        }
+        myThread.refCount++;
     }
     
-    bool 
-    ThreadedProcedure::checkParent(void)
+    void
+    ThreadedProcedure::setDeferRefs(bool defer)
+    {
+        deferRefs_ = defer;
+    }
+    
+    void
+    ThreadedProcedure::foldRefs(void)
+    {
+        ThreadedProcedure * tp = myThread.refTP;
+        if(tp)
+        {
+            unsigned int count = myThread.refCount;
+            myThread.refTP = NULL;
+            myThread.refCount = 0;
+            if(count == Atomics::fetchSub(tp->ref_, count))
+                delete tp;
+        }
+    }
+    
+    bool
+    ThreadedProcedure::zeroRef(void)
     {
-        if(parentTP_==NULL)
-            return false;
-        if(parentTP_==this)
-            return false;
-        return true;
-        //return (parentTP_!=this);
+        return (!ref_);
     }
     
     void 
     ThreadedProcedure::add(Codelet * toAdd)
     {
-        //check on where to set
+        //A TP built by a worker keeps its first codelets on that worker
         if(toAdd->codeletReady())
         {
-            Atomics::fetchAdd(ref_, 1U);
-            myThread.threadTPsched->pushCodelet(toAdd);
+            if(taskGraph * graph = taskGraph::capturing())
+                graph->started(this, toAdd);
+            incRef();
+            toAdd->enqueue();
         }
     }    
 }
@@ -0,0 +1,182 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "loopAffinity.h"
+#include "Atomics.h"
+#include "threadlocal.h"
+
+namespace darts
+{
+    static inline uint64_t
+    packBounds(unsigned int head, unsigned int tail)
+    {
+        return ((uint64_t) tail << 32) | head;
+    }
+    
+    static inline unsigned int
+    currentWorker(void)
+    {
+        if(myThread.threadMCsched)
+            return myThread.threadMCsched->getID();
+        return myThread.threadTPsched->getID();
+    }
+    
+    loopAffinity::loopAffinity(void):
+    iterations_(0),
+    slots_(0),
+    owner_(NULL),
+    order_(NULL),
+    first_(NULL),
+    lanes_(NULL),
+    moved_(0)
+    { }
+    
+    loopAffinity::~loopAffinity(void)
+    {
+        clear();
+    }
+    
+    void
+    loopAffinity::clear(void)
+    {
+        delete [] owner_;
+        delete [] order_;
+        delete [] first_;
+        delete [] lanes_;
+        owner_ = NULL;
+        order_ = NULL;
+        first_ = NULL;
+        lanes_ = NULL;
+        iterations_ = 0;
+        slots_ = 0;
+    }
+    
+    void
+    loopAffinity::reset(void)
+    {
+        for(unsigned int i = 0; i < iterations_; i++)
+            owner_[i] = slots_;
+        moved_ = 0;
+    }
+    
+    unsigned int
+    loopAffinity::prepare(unsigned int iterations)
+    {
+        unsigned int tps = myThread.threadTPsched->getNumTPSched();
+        unsigned int mcs = myThread.threadTPsched->getNumMCSched();
+        if(!tps)
+            tps = 1;
+        unsigned int slots = tps * (1 + mcs);
+        
+        if(iterations != iterations_ || slots != slots_)
+        {
+            clear();
+            iterations_ = iterations;
+            slots_ = slots;
+            owner_ = new unsigned int[iterations_];
+            order_ = new unsigned int[iterations_];
+            first_ = new unsigned int[slots_ + 2];
+            lanes_ = new lane[slots_ + 1];
+            reset();
+        }
+        
+        //Counting sort of the iterations by the worker that ran them
+        for(unsigned int l = 0; l < slots_ + 2; l++)
+            first_[l] = 0;
+        for(unsigned int i = 0; i < iterations_; i++)
+            first_[owner_[i] + 1]++;
+        for(unsigned int l = 0; l < slots_ + 1; l++)
+            first_[l + 1] += first_[l];
+        for(unsigned int i = 0; i < iterations_; i++)
+            order_[first_[owner_[i]]++] = i;
+        //first_[l] is now where lane l ends
+        for(unsigned int l = 0; l < slots_ + 1; l++)
+            lanes_[l].bounds = packBounds((l) ? first_[l - 1] : 0, first_[l]);
+        moved_ = 0;
+        return tps * ((mcs) ? mcs : 1);
+    }
+    
+    bool
+    loopAffinity::takeFront(unsigned int which, unsigned int & it)
+    {
+        while(true)
+        {
+            uint64_t bounds = lanes_[which].bounds;
+            unsigned int head = (unsigned int) bounds;
+            unsigned int tail = (unsigned int) (bounds >> 32);
+            if(head >= tail)
+                return false;
+            if(Atomics::boolcompareAndSwap(lanes_[which].bounds, bounds, packBounds(head + 1, tail)))
+            {
+                it = order_[head];
+                return true;
+            }
+        }
+    }
+    
+    bool
+    loopAffinity::takeBack(unsigned int which, unsigned int & it)
+    {
+        while(true)
+        {
+            uint64_t bounds = lanes_[which].bounds;
+            unsigned int head = (unsigned int) bounds;
+            unsigned int tail = (unsigned int) (bounds >> 32);
+            if(head >= tail)
+                return false;
+            if(Atomics::boolcompareAndSwap(lanes_[which].bounds, bounds, packBounds(head, tail - 1)))
+            {
+                it = order_[tail - 1];
+                return true;
+            }
+        }
+    }
+    
+    bool
+    loopAffinity::claim(unsigned int & it)
+    {
+        unsigned int me = currentWorker();
+        unsigned int mine = (me < slots_) ? me : slots_;
+        bool found = takeFront(mine, it) || takeFront(slots_, it);
+        for(unsigned int i = 1; !found && i <= slots_; i++)
+        {
+            unsigned int victim = (mine + i) % slots_;
+            if(victim != mine)
+                found = takeBack(victim, it);
+        }
+        if(!found)
+            return false;
+        if(owner_[it] != mine)
+        {
+            if(owner_[it] != slots_)
+                Atomics::fetchAdd(moved_, 1U);
+            owner_[it] = mine;
+        }
+        return true;
+    }
+}
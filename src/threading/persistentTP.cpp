@@ -0,0 +1,96 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "persistentTP.h"
+
+namespace darts
+{
+    void
+    persistentTP::epochBarrier::fire(void)
+    {
+        persistentTP * myTP = static_cast<persistentTP*>(myTP_);
+        myTP->epoch_++;
+        myTP->epochDone();
+    }
+    
+    persistentTP::persistentTP(void):
+    ThreadedProcedure(),
+    barrier_(this),
+    epoch_(0),
+    retired_(false)
+    {
+        incRef();
+    }
+    
+    void
+    persistentTP::addMember(Codelet * member, bool starts)
+    {
+        members_.push_back(member);
+        if(starts)
+            starters_.push_back(member);
+    }
+    
+    //The barrier counts one more arrival, made once every starting member
+    //is added, so an epoch without members still ends
+    void
+    persistentTP::begin(void)
+    {
+        uint32_t count = members_.size() + 1;
+        barrier_.initCodelet(count, count, this, LONGWAIT);
+        for(size_t i = 0; i < starters_.size(); i++)
+            add(starters_[i]);
+        arrive();
+    }
+    
+    void
+    persistentTP::rearm(void)
+    {
+        for(size_t i = 0; i < members_.size(); i++)
+            members_[i]->resetCodelet();
+        barrier_.resetCodelet();
+    }
+    
+    void
+    persistentTP::nextEpoch(void)
+    {
+        rearm();
+        for(size_t i = 0; i < starters_.size(); i++)
+            add(starters_[i]);
+        arrive();
+    }
+    
+    void
+    persistentTP::retire(void)
+    {
+        if(!retired_)
+        {
+            retired_ = true;
+            deferDecRef();
+        }
+    }
+}
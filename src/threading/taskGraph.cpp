@@ -0,0 +1,257 @@
+/* 
+ * Copyright (c) 2011-2014, University of Delaware
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 
+ * 1. Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "taskGraph.h"
+#include "Codelet.h"
+#include "ThreadedProcedure.h"
+#include "Atomics.h"
+#include "threadlocal.h"
+
+//Child slot whose TP was never built
+#define NO_NODE ((unsigned int) -1)
+
+namespace darts
+{
+    taskGraph * volatile taskGraph::capture_ = NULL;
+    taskGraph * volatile taskGraph::replay_ = NULL;
+    
+    taskGraph::taskGraph(void):
+    root_(NO_NODE),
+    edges_(0),
+    captured_(false)
+    { }
+    
+    taskGraph::~taskGraph(void)
+    {
+        clear();
+    }
+    
+    void
+    taskGraph::clear(void)
+    {
+        //Children before their parents, a parent keeps its reference until
+        //we reach it so no TP is deleted under us. The root TP has no parent
+        //to release it and is ours to delete
+        for(size_t i = nodes_.size(); i-- > 0;)
+        {
+            ThreadedProcedure * tp = nodes_[i].tp;
+            tp->node_ = 0;
+            if(i != root_ && tp->decRef())
+                delete tp;
+        }
+        if(root_ != NO_NODE)
+            delete nodes_[root_].tp;
+        nodes_.clear();
+        children_.clear();
+        roots_.clear();
+        counters_.clear();
+        root_ = NO_NODE;
+        edges_ = 0;
+        captured_ = false;
+    }
+    
+    taskGraph::node *
+    taskGraph::find(ThreadedProcedure * tp)
+    {
+        unsigned int n = tp->node_;
+        if(n && n <= nodes_.size() && nodes_[n - 1].tp == tp)
+            return &nodes_[n - 1];
+        return NULL;
+    }
+    
+    void
+    taskGraph::beginCapture(void)
+    {
+        clear();
+        capture_ = this;
+    }
+    
+    void
+    taskGraph::endCapture(void)
+    {
+        lock_.lock();
+        capture_ = NULL;
+        for(size_t i = 0; i < nodes_.size(); i++)
+        {
+            node & n = nodes_[i];
+            n.firstChild = children_.size();
+            for(size_t j = 0; j < capChildren_[i].size(); j++)
+            {
+                if(capChildren_[i][j] != NO_NODE)
+                    children_.push_back(capChildren_[i][j]);
+            }
+            n.numChildren = children_.size() - n.firstChild;
+            n.firstRoot = roots_.size();
+            roots_.insert(roots_.end(), capRoots_[i].begin(), capRoots_[i].end());
+            n.numRoots = roots_.size() - n.firstRoot;
+        }
+        capChildren_.clear();
+        capRoots_.clear();
+        pending_.clear();
+        touched_.clear();
+        captured_ = (root_ != NO_NODE);
+        lock_.unlock();
+    }
+    
+    void
+    taskGraph::beginReplay(void)
+    {
+        for(size_t i = 0; i < counters_.size(); i++)
+            counters_[i].codelet->getSyncSlot()->initSyncSlot(counters_[i].dep, counters_[i].res);
+        for(size_t i = 0; i < nodes_.size(); i++)
+            nodes_[i].cursor = 0;
+        replay_ = this;
+        rearm(nodes_[root_], NULL);
+    }
+    
+    void
+    taskGraph::endReplay(void)
+    {
+        replay_ = NULL;
+    }
+    
+    void
+    taskGraph::rearm(node & child, TPScheduler * target)
+    {
+        for(unsigned int i = 0; i < child.numRoots; i++)
+        {
+            Codelet * toStart = roots_[child.firstRoot + i];
+            if(target)
+            {
+                child.tp->incRef();
+                target->pushCodelet(toStart);
+            }
+            else
+                child.tp->add(toStart);
+        }
+    }
+    
+    bool
+    taskGraph::replayChild(ThreadedProcedure * parent, TPScheduler * target)
+    {
+        node * n = find(parent);
+        if(!n)
+            return false;
+        unsigned int next = Atomics::fetchAdd(n->cursor, 1U);
+        if(next >= n->numChildren)
+            return false;
+        rearm(nodes_[children_[n->firstChild + next]], target);
+        return true;
+    }
+    
+    //The TP is kept alive until clear, whatever its codelets do
+    void
+    taskGraph::keep(ThreadedProcedure * tp)
+    {
+        lock_.lock();
+        if(capture_ == this)
+        {
+            node n = { tp, 0, 0, 0, 0, 0, false };
+            nodes_.push_back(n);
+            capChildren_.push_back(std::vector<unsigned int>());
+            capRoots_.push_back(std::vector<Codelet*>());
+            tp->node_ = nodes_.size();
+            tp->incRef();
+        }
+        lock_.unlock();
+    }
+    
+    void
+    taskGraph::built(tpClosure * closure, ThreadedProcedure * tp)
+    {
+        lock_.lock();
+        node * n = (capture_ == this) ? find(tp) : NULL;
+        if(n)
+        {
+            n->built = true;
+            std::map<tpClosure*, std::pair<unsigned int, unsigned int> >::iterator slot = pending_.find(closure);
+            if(slot != pending_.end())
+            {
+                capChildren_[slot->second.first][slot->second.second] = tp->node_ - 1;
+                pending_.erase(slot);
+            }
+            else if(!tp->parentTP_ && root_ == NO_NODE)
+                root_ = tp->node_ - 1;
+        }
+        lock_.unlock();
+    }
+    
+    void
+    taskGraph::invoked(ThreadedProcedure * parent, tpClosure * closure)
+    {
+        lock_.lock();
+        node * n = (capture_ == this) ? find(parent) : NULL;
+        if(n)
+        {
+            unsigned int p = parent->node_ - 1;
+            pending_[closure] = std::make_pair(p, (unsigned int) capChildren_[p].size());
+            capChildren_[p].push_back(NO_NODE);
+            edges_++;
+        }
+        lock_.unlock();
+    }
+    
+    //Only the codelets a TP starts with while it is built, the ones added
+    //later are added again by the codelets replayed
+    void
+    taskGraph::started(ThreadedProcedure * tp, Codelet * toAdd)
+    {
+        lock_.lock();
+        node * n = (capture_ == this) ? find(tp) : NULL;
+        if(n && !n->built)
+        {
+            capRoots_[tp->node_ - 1].push_back(toAdd);
+            if(touched_.insert(toAdd).second)
+            {
+                counter c = { toAdd, toAdd->getCounter(), toAdd->getSyncSlot()->getReset() };
+                counters_.push_back(c);
+            }
+        }
+        lock_.unlock();
+    }
+    
+    //Called before the counter drops, so the first call sees its initial value
+    void
+    taskGraph::signaled(Codelet * codelet)
+    {
+        ThreadedProcedure * tp = codelet->getTP();
+        if(!tp)
+            return;
+        lock_.lock();
+        if(capture_ == this && find(tp))
+        {
+            edges_++;
+            if(touched_.insert(codelet).second)
+            {
+                counter c = { codelet, codelet->getCounter(), codelet->getSyncSlot()->getReset() };
+                counters_.push_back(c);
+            }
+        }
+        lock_.unlock();
+    }
+}